@@ -0,0 +1,312 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+//-------------------------------------------------------------------------
+//  Process-wide cache of calibration objects (OCDB entries and OADB
+//  containers) shared by the tender supplies and the analysis tasks
+//-------------------------------------------------------------------------
+
+#include <TFile.h>
+#include <TH1.h>
+#include <TSystem.h>
+#include <TPRegexp.h>
+#include <TObjArray.h>
+#include <TObjString.h>
+
+#include "AliLog.h"
+#include "AliCDBManager.h"
+#include "AliCDBStorage.h"
+#include "AliCDBEntry.h"
+#include "AliCDBId.h"
+#include "AliOADBContainer.h"
+#include "AliCalibObjectCache.h"
+
+ClassImp(AliCalibObjectCache)
+
+AliCalibObjectCache* AliCalibObjectCache::fgInstance=0x0;
+
+//_____________________________________________________________________
+AliCalibObjectCache::AliCalibObjectCache():
+  TObject(),
+  fLocalStore(),
+  fNLookups(0),
+  fNHits(0),
+  fCDBObjects(),
+  fCDBRunIndex(),
+  fOADBContainers()
+{
+  // Default constructor, use Instance()
+}
+
+//_____________________________________________________________________
+AliCalibObjectCache::~AliCalibObjectCache()
+{
+  // Destructor
+  Reset();
+  if (fgInstance==this) fgInstance=0x0;
+}
+
+//_____________________________________________________________________
+AliCalibObjectCache* AliCalibObjectCache::Instance()
+{
+  // Access to the process-wide instance
+  if (!fgInstance) fgInstance=new AliCalibObjectCache();
+  return fgInstance;
+}
+
+//_____________________________________________________________________
+void AliCalibObjectCache::Reset()
+{
+  // Delete all the cached objects
+  std::map<std::string,std::vector<CDBObject> >::iterator itc;
+  for (itc=fCDBObjects.begin(); itc!=fCDBObjects.end(); ++itc) {
+    for (size_t i=0; i<itc->second.size(); ++i) delete itc->second[i].fObject;
+  }
+  fCDBObjects.clear();
+  fCDBRunIndex.clear();
+  std::map<std::string,AliOADBContainer*>::iterator ito;
+  for (ito=fOADBContainers.begin(); ito!=fOADBContainers.end(); ++ito) delete ito->second;
+  fOADBContainers.clear();
+}
+
+//_____________________________________________________________________
+TObject* AliCalibObjectCache::GetCDBObject(const char* path, Int_t run)
+{
+  //
+  // Return the object of the OCDB entry 'path' valid for 'run'.
+  // The id valid for 'run' is resolved once per run against the storage of
+  // the AliCDBManager serving 'path'. The object with that id is looked up
+  // in memory, then in the local store (if set) and finally fetched from
+  // the storage. The returned object is owned by the cache.
+  //
+  fNLookups++;
+  AliCDBStorage *storage=GetStorage(path);
+  if (!storage) {
+    AliError(Form("No OCDB storage set, cannot load %s for run %d",path,run));
+    return 0x0;
+  }
+  TString uri=storage->GetURI();
+  std::string key=Form("%s#%s",uri.Data(),path);
+  std::vector<CDBObject> &objects=fCDBObjects[key];
+  std::map<Int_t,size_t> &runIndex=fCDBRunIndex[key];
+  std::map<Int_t,size_t>::const_iterator itr=runIndex.find(run);
+  if (itr!=runIndex.end()) {
+    fNHits++;
+    return objects[itr->second].fObject;
+  }
+
+  // a default object valid for an open range may be superseded by a higher
+  // version for a part of it, so the validity range alone cannot be trusted
+  AliCDBId *id=storage->GetId(AliCDBId(path,run,run));
+  if (!id) {
+    AliError(Form("No OCDB entry %s found for run %d",path,run));
+    return 0x0;
+  }
+  CDBObject obj;
+  obj.fFirstRun=id->GetFirstRun();
+  obj.fLastRun=id->GetLastRun();
+  obj.fVersion=id->GetVersion();
+  obj.fSubVersion=id->GetSubVersion();
+  obj.fObject=0x0;
+  delete id;
+  for (size_t i=0; i<objects.size(); ++i) {
+    if (objects[i].fFirstRun==obj.fFirstRun && objects[i].fLastRun==obj.fLastRun &&
+        objects[i].fVersion==obj.fVersion && objects[i].fSubVersion==obj.fSubVersion) {
+      fNHits++;
+      runIndex[run]=i;
+      return objects[i].fObject;
+    }
+  }
+
+  if (!ReadFromLocalStore(path,uri.Data(),obj)) {
+    AliCDBEntry *entry=AliCDBManager::Instance()->Get(path,run);
+    if (!entry || !entry->GetObject()) {
+      AliError(Form("No OCDB entry %s found for run %d",path,run));
+      return 0x0;
+    }
+    // keep a private copy, the manager cache is cleared on run changes
+    Bool_t addStatus=TH1::AddDirectoryStatus();
+    TH1::AddDirectory(kFALSE);
+    obj.fObject=entry->GetObject()->Clone();
+    TH1::AddDirectory(addStatus);
+    obj.fFirstRun=entry->GetId().GetFirstRun();
+    obj.fLastRun=entry->GetId().GetLastRun();
+    obj.fVersion=entry->GetId().GetVersion();
+    obj.fSubVersion=entry->GetId().GetSubVersion();
+    if (!fLocalStore.IsNull()) WriteToLocalStore(path,uri.Data(),obj);
+  }
+  AliInfo(Form("Caching %s v%d_s%d valid for runs %d-%d",path,obj.fVersion,obj.fSubVersion,obj.fFirstRun,obj.fLastRun));
+  runIndex[run]=objects.size();
+  objects.push_back(obj);
+  return obj.fObject;
+}
+
+//_____________________________________________________________________
+AliOADBContainer* AliCalibObjectCache::GetOADBContainer(const char* fileName, const char* containerName)
+{
+  //
+  // Return the OADB container 'containerName' of 'fileName', read once per process.
+  // The container is owned by the cache.
+  //
+  fNLookups++;
+  std::string key=Form("%s#%s",fileName,containerName);
+  std::map<std::string,AliOADBContainer*>::const_iterator it=fOADBContainers.find(key);
+  if (it!=fOADBContainers.end()) {
+    fNHits++;
+    return it->second;
+  }
+
+  Bool_t addStatus=TH1::AddDirectoryStatus();
+  TH1::AddDirectory(kFALSE);
+  AliOADBContainer *cont=0x0;
+  TFile *f=TFile::Open(fileName);
+  if (f && f->IsOpen()) {
+    cont=dynamic_cast<AliOADBContainer*>(f->Get(containerName));
+    f->Close();
+  }
+  delete f;
+  TH1::AddDirectory(addStatus);
+  if (!cont) AliError(Form("OADB container %s not found in %s",containerName,fileName));
+  // failures are cached as well, not to retry the file access on every run
+  fOADBContainers[key]=cont;
+  return cont;
+}
+
+//_____________________________________________________________________
+TObject* AliCalibObjectCache::GetOADBObject(const char* fileName, const char* containerName, Int_t run,
+                                            const char* defaultName, const char* passName)
+{
+  //
+  // Return the object of the OADB container valid for 'run' and 'passName'
+  // The object is owned by the cache.
+  //
+  AliOADBContainer *cont=GetOADBContainer(fileName,containerName);
+  if (!cont) return 0x0;
+  return cont->GetObject(run,defaultName,passName);
+}
+
+//_____________________________________________________________________
+AliCDBStorage* AliCalibObjectCache::GetStorage(const char* path) const
+{
+  // OCDB storage serving 'path', 0x0 if none is set
+  AliCDBManager *cdb=AliCDBManager::Instance();
+  AliCDBStorage *storage=cdb->GetSpecificStorage(path);
+  if (!storage && cdb->IsDefaultStorageSet()) storage=cdb->GetDefaultStorage();
+  return storage;
+}
+
+//_____________________________________________________________________
+TString AliCalibObjectCache::LocalStoreDir(const char* uri) const
+{
+  // Subdirectory of the local store holding the objects of the storage 'uri'
+  return Form("%s/%08x",fLocalStore.Data(),TString(uri).Hash());
+}
+
+//_____________________________________________________________________
+TString AliCalibObjectCache::LocalStoreFileName(const char* path, const char* uri, const CDBObject &obj) const
+{
+  // Name of the local store file of an OCDB object
+  TString name(path);
+  name.ReplaceAll("/","_");
+  return Form("%s/%s_Run%d_%d_v%d_s%d.root",LocalStoreDir(uri).Data(),name.Data(),
+              obj.fFirstRun,obj.fLastRun,obj.fVersion,obj.fSubVersion);
+}
+
+//_____________________________________________________________________
+Bool_t AliCalibObjectCache::ReadFromLocalStore(const char* path, const char* uri, CDBObject &obj) const
+{
+  //
+  // Look up in the local store the file holding 'path' of the storage 'uri'
+  // with the run range, version and subversion of 'obj', as resolved
+  // against the storage. The storage URI and the id saved in the file are
+  // checked against the request before the object is used.
+  //
+  if (fLocalStore.IsNull()) return kFALSE;
+  TString fileName=LocalStoreFileName(path,uri,obj);
+  if (gSystem->AccessPathName(fileName.Data())) return kFALSE;
+
+  // histograms must not be attached to the file, which is closed right away
+  Bool_t addStatus=TH1::AddDirectoryStatus();
+  TH1::AddDirectory(kFALSE);
+  TObject *object=0x0;
+  TFile *f=TFile::Open(fileName.Data());
+  if (f && f->IsOpen()) {
+    TObjString *storedURI=dynamic_cast<TObjString*>(f->Get("uri"));
+    AliCDBId *storedId=dynamic_cast<AliCDBId*>(f->Get("id"));
+    if (storedURI && storedId && storedURI->GetString()==uri &&
+        storedId->GetPath()==path &&
+        storedId->GetFirstRun()==obj.fFirstRun && storedId->GetLastRun()==obj.fLastRun &&
+        storedId->GetVersion()==obj.fVersion && storedId->GetSubVersion()==obj.fSubVersion) {
+      object=f->Get("object");
+    } else {
+      AliWarning(Form("%s does not match %s of %s, ignored",fileName.Data(),path,uri));
+    }
+    delete storedURI;
+    delete storedId;
+    f->Close();
+  }
+  delete f;
+  TH1::AddDirectory(addStatus);
+  if (!object) return kFALSE;
+  AliInfo(Form("%s v%d_s%d read from the local store %s",path,obj.fVersion,obj.fSubVersion,fileName.Data()));
+  obj.fObject=object;
+  return kTRUE;
+}
+
+//_____________________________________________________________________
+void AliCalibObjectCache::WriteToLocalStore(const char* path, const char* uri, const CDBObject &obj) const
+{
+  //
+  // Save an OCDB object in the local store, together with the storage URI
+  // and the id of the entry used to check it on reading. The file is
+  // written under a temporary name and renamed, so that concurrent jobs
+  // never read a partially written file.
+  //
+  gSystem->mkdir(LocalStoreDir(uri).Data(),kTRUE);
+  TString fileName=LocalStoreFileName(path,uri,obj);
+  if (!gSystem->AccessPathName(fileName.Data())) return;
+  TString tmpName=Form("%s.%d.tmp",fileName.Data(),gSystem->GetPid());
+  TFile *f=TFile::Open(tmpName.Data(),"RECREATE");
+  if (!f || !f->IsOpen()) {
+    AliWarning(Form("Cannot write to the local store %s",fLocalStore.Data()));
+    delete f;
+    return;
+  }
+  AliCDBId id(path,obj.fFirstRun,obj.fLastRun,obj.fVersion,obj.fSubVersion);
+  TObjString storedURI(uri);
+  obj.fObject->Write("object",TObject::kSingleKey);
+  id.Write("id");
+  storedURI.Write("uri");
+  f->Close();
+  delete f;
+  if (gSystem->Rename(tmpName.Data(),fileName.Data())) gSystem->Unlink(tmpName.Data());
+}
+
+//_____________________________________________________________________
+void AliCalibObjectCache::Print(Option_t* /*option*/) const
+{
+  // Print the content of the cache
+  Printf("AliCalibObjectCache: %lld lookups, %lld served from memory",fNLookups,fNHits);
+  if (!fLocalStore.IsNull()) Printf("  local store: %s",fLocalStore.Data());
+  std::map<std::string,std::vector<CDBObject> >::const_iterator itc;
+  for (itc=fCDBObjects.begin(); itc!=fCDBObjects.end(); ++itc) {
+    for (size_t i=0; i<itc->second.size(); ++i)
+      Printf("  OCDB %s [%d,%d] v%d_s%d",itc->first.c_str(),itc->second[i].fFirstRun,itc->second[i].fLastRun,
+             itc->second[i].fVersion,itc->second[i].fSubVersion);
+  }
+  std::map<std::string,AliOADBContainer*>::const_iterator ito;
+  for (ito=fOADBContainers.begin(); ito!=fOADBContainers.end(); ++ito)
+    Printf("  OADB %s%s",ito->first.c_str(),ito->second ? "" : " (not found)");
+}
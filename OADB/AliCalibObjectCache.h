@@ -0,0 +1,86 @@
+#ifndef ALICALIBOBJECTCACHE_H
+#define ALICALIBOBJECTCACHE_H
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+//-------------------------------------------------------------------------
+//  Process-wide cache of calibration objects
+//
+//  OCDB entries are kept together with their id, so that a multi-run job
+//  fetches every object once per entry rather than once per run change of
+//  each tender supply or task. On every new run the id valid for that run
+//  (highest version whose range contains the run) is resolved against the
+//  storage, and a cached object is reused only if it has that id. OADB
+//  containers are read once per file and container name. Optionally the
+//  OCDB objects are written to a local store directory which is looked up
+//  before the OCDB, so that the jobs running on the same node share the
+//  downloads. The local store is keyed on the URI of the OCDB storage and
+//  on the version of the entry, so that jobs using different OCDBs never
+//  read each other's objects.
+//  The cached objects are owned by the cache: clients must not delete them
+//  and must Clone() them if they need to modify or own them.
+//-------------------------------------------------------------------------
+
+#include <map>
+#include <vector>
+#include <string>
+#include <TObject.h>
+#include <TString.h>
+
+class AliOADBContainer;
+class AliCDBStorage;
+
+class AliCalibObjectCache : public TObject
+{
+ public:
+
+  static AliCalibObjectCache* Instance();
+  virtual ~AliCalibObjectCache();
+
+  TObject* GetCDBObject(const char* path, Int_t run);
+  TObject* GetOADBObject(const char* fileName, const char* containerName, Int_t run,
+                         const char* defaultName="", const char* passName="");
+  AliOADBContainer* GetOADBContainer(const char* fileName, const char* containerName);
+
+  void SetLocalStore(const char* dir) {fLocalStore=dir;}
+  const char* GetLocalStore() const {return fLocalStore.Data();}
+
+  void Reset();
+  virtual void Print(Option_t* option="") const;
+
+  Long64_t GetNLookups() const {return fNLookups;}
+  Long64_t GetNHits() const {return fNHits;}
+
+ private:
+
+  AliCalibObjectCache();
+  AliCalibObjectCache(const AliCalibObjectCache& source);
+  AliCalibObjectCache& operator=(const AliCalibObjectCache& source);
+
+  struct CDBObject {
+    Int_t    fFirstRun;   // first run of the validity range
+    Int_t    fLastRun;    // last run of the validity range
+    Int_t    fVersion;    // version of the OCDB entry
+    Int_t    fSubVersion; // subversion of the OCDB entry
+    TObject* fObject;     // owned copy of the OCDB object
+  };
+
+  AliCDBStorage* GetStorage(const char* path) const;
+  TString  LocalStoreDir(const char* uri) const;
+  TString  LocalStoreFileName(const char* path, const char* uri, const CDBObject &obj) const;
+  Bool_t   ReadFromLocalStore(const char* path, const char* uri, CDBObject &obj) const;
+  void     WriteToLocalStore(const char* path, const char* uri, const CDBObject &obj) const;
+
+  static AliCalibObjectCache* fgInstance; // singleton instance
+
+  TString  fLocalStore;  //! directory of the local store, empty if not used
+  Long64_t fNLookups;    //! number of lookups
+  Long64_t fNHits;       //! number of lookups served from memory
+  std::map<std::string,std::vector<CDBObject> > fCDBObjects;     //! OCDB objects per storage and path
+  std::map<std::string,std::map<Int_t,size_t> > fCDBRunIndex;    //! index of the object resolved for each run per storage and path
+  std::map<std::string,AliOADBContainer*>       fOADBContainers; //! OADB containers per file and name
+
+  ClassDef(AliCalibObjectCache,3); // Process-wide cache of calibration objects
+};
+
+#endif
@@ -77,6 +77,12 @@
 
 ClassImp(AliCentralitySelectionTask)
 
+const char* AliCentralitySelectionTask::fgkEstimatorNames[AliCentralitySelectionTask::kNEstimators] = {
+  "V0M", "V0A", "V0A0", "V0A123", "V0C", "V0A23", "V0C01", "V0S",
+  "V0MEq", "V0AEq", "V0CEq", "FMD", "TRK", "TKL", "CL0", "CL1", "CND",
+  "ZNA", "ZNC", "ZPA", "ZPC", "NPA", "V0MvsFMD", "TKLvsV0M", "ZEMvsZDC"
+};
+
 
 //________________________________________________________________________
 AliCentralitySelectionTask::AliCentralitySelectionTask():
@@ -87,6 +93,8 @@ AliAnalysisTaskSE(),
   fUseScaling(0),
   fUseCleaning(0),
   fFillHistos(0),
+  fEstimatorMask(0xffffffff),
+  fMeasureCost(kFALSE),
   fV0MScaleFactor(0),
   fSPDScaleFactor(0),
   fTPCScaleFactor(0),
@@ -211,6 +219,8 @@ AliAnalysisTaskSE(),
   fHtempZNCtrue(0),
   fHtempZPAtrue(0),
   fHtempZPCtrue(0),
+  fTableContent(),
+  fCostWatch(),
   fOutputList(0),
   fHOutCentV0M(0),
   fHOutCentV0A(0),
@@ -336,7 +346,8 @@ AliAnalysisTaskSE(),
   fHOutMultTRKvsCL1qual2(0),
   fHOutQuality(0),
   fHOutVertex(0),
-  fHOutVertexT0(0)
+  fHOutVertexT0(0),
+  fHOutInputCost(0)
 {   
   // Default constructor
   AliInfo("Centrality Selection enabled.");
@@ -344,6 +355,9 @@ AliAnalysisTaskSE(),
   fUseScaling=kTRUE;
   fUseCleaning=kTRUE;
   fFillHistos=kFALSE;
+  for (Int_t i=0; i<kNEstimators; i++) {
+    fTableNbins[i]=0; fTableOffset[i]=0; fTableXmin[i]=0; fTableXmax[i]=0;
+  }
   fBranchNames="ESD:AliESDRun.,AliESDHeader.,AliESDZDC.,AliESDFMD.,AliESDVZERO.,AliESDTZERO."
     ",SPDVertex.,TPCVertex.,PrimaryVertex.,AliMultiplicity.,Tracks ";
 }   
@@ -357,6 +371,8 @@ AliCentralitySelectionTask::AliCentralitySelectionTask(const char *name):
   fUseScaling(0),
   fUseCleaning(0),
   fFillHistos(0),
+  fEstimatorMask(0xffffffff),
+  fMeasureCost(kFALSE),
   fV0MScaleFactor(0),
   fSPDScaleFactor(0),
   fTPCScaleFactor(0),
@@ -481,6 +497,8 @@ AliCentralitySelectionTask::AliCentralitySelectionTask(const char *name):
   fHtempZNCtrue(0),
   fHtempZPAtrue(0),
   fHtempZPCtrue(0),
+  fTableContent(),
+  fCostWatch(),
   fOutputList(0),
   fHOutCentV0M(0),
   fHOutCentV0A(0),
@@ -606,7 +624,8 @@ AliCentralitySelectionTask::AliCentralitySelectionTask(const char *name):
   fHOutMultTRKvsCL1qual2(0),
   fHOutQuality(0),
   fHOutVertex(0),
-  fHOutVertexT0(0)
+  fHOutVertexT0(0),
+  fHOutInputCost(0)
 {
   // Default constructor
   AliInfo("Centrality Selection enabled.");
@@ -614,6 +633,9 @@ AliCentralitySelectionTask::AliCentralitySelectionTask(const char *name):
   fUseScaling=kTRUE;
   fUseCleaning=kTRUE;
   fFillHistos=kFALSE;
+  for (Int_t i=0; i<kNEstimators; i++) {
+    fTableNbins[i]=0; fTableOffset[i]=0; fTableXmin[i]=0; fTableXmax[i]=0;
+  }
   fBranchNames="ESD:AliESDRun.,AliESDHeader.,AliESDZDC.,AliESDFMD.,AliESDVZERO.,AliESDTZERO."
     ",SPDVertex.,TPCVertex.,PrimaryVertex.,AliMultiplicity.,Tracks ";
 }
@@ -637,6 +659,8 @@ AliCentralitySelectionTask::AliCentralitySelectionTask(const AliCentralitySelect
   fUseScaling(ana.fUseScaling),
   fUseCleaning(ana.fUseCleaning),
   fFillHistos(ana.fFillHistos),
+  fEstimatorMask(ana.fEstimatorMask),
+  fMeasureCost(ana.fMeasureCost),
   fV0MScaleFactor(ana.fV0MScaleFactor),
   fSPDScaleFactor(ana.fSPDScaleFactor),
   fTPCScaleFactor(ana.fTPCScaleFactor),
@@ -761,6 +785,8 @@ AliCentralitySelectionTask::AliCentralitySelectionTask(const AliCentralitySelect
   fHtempZNCtrue(ana.fHtempZNCtrue),
   fHtempZPAtrue(ana.fHtempZPAtrue),
   fHtempZPCtrue(ana.fHtempZPCtrue),
+  fTableContent(ana.fTableContent),
+  fCostWatch(),
   fOutputList(ana.fOutputList),
   fHOutCentV0M(ana.fHOutCentV0M),
   fHOutCentV0A(ana.fHOutCentV0A),
@@ -886,9 +912,16 @@ AliCentralitySelectionTask::AliCentralitySelectionTask(const AliCentralitySelect
   fHOutMultTRKvsCL1qual2(ana.fHOutMultTRKvsCL1qual2),
   fHOutQuality(ana.fHOutQuality),
   fHOutVertex(ana.fHOutVertex),
-  fHOutVertexT0(ana.fHOutVertexT0)
+  fHOutVertexT0(ana.fHOutVertexT0),
+  fHOutInputCost(ana.fHOutInputCost)
 {
   // Copy Constructor	
+  for (Int_t i=0; i<kNEstimators; i++) {
+    fTableNbins[i]  = ana.fTableNbins[i];
+    fTableOffset[i] = ana.fTableOffset[i];
+    fTableXmin[i]   = ana.fTableXmin[i];
+    fTableXmax[i]   = ana.fTableXmax[i];
+  }
 
 }
 
@@ -1046,6 +1079,11 @@ void AliCentralitySelectionTask::UserCreateOutputObjects()
     fHOutQuality = new TH1F("fHOutQuality", "fHOutQuality", 100,-0.5,99.5);
     fHOutVertex  = new TH1F("fHOutVertex", "fHOutVertex", 100,-20,20);
     fHOutVertexT0  = new TH1F("fHOutVertexT0", "fHOutVertexT0", 100,-20,20);
+    if (fMeasureCost) {
+      const char* costLabels[kNCostBlocks] = {"V0","T0","trigger","TRK","CND","SPD","FMD","ZDC","MC","percentiles"};
+      fHOutInputCost = new TH1F("fHOutInputCost", "fHOutInputCost; ; time (#mus)", kNCostBlocks,-0.5,kNCostBlocks-0.5);
+      for (Int_t i=0; i<kNCostBlocks; i++) fHOutInputCost->GetXaxis()->SetBinLabel(i+1,costLabels[i]);
+    }
   
     fOutputList->Add(fHOutCentV0M);
     fOutputList->Add(fHOutCentV0A);
@@ -1173,6 +1211,7 @@ void AliCentralitySelectionTask::UserCreateOutputObjects()
     fOutputList->Add(fHOutQuality);
     fOutputList->Add(fHOutVertex);
     fOutputList->Add(fHOutVertexT0);
+    if (fHOutInputCost) fOutputList->Add(fHOutInputCost);
   
     PostData(1, fOutputList); 
   }
@@ -1317,6 +1356,15 @@ void AliCentralitySelectionTask::UserExec(Option_t */*option*/)
     return;
   }
 
+  // estimators to be evaluated and the inputs they need
+  const UInt_t mask      = GetEffectiveEstimatorMask();
+  const Bool_t cleanData = fUseCleaning && !fIsMCInput;
+  const Bool_t needTRK   = (mask & BIT(kTRK)) || cleanData;
+  const Bool_t needCND   = (mask & BIT(kCND));
+  const Bool_t needFMD   = (mask & BIT(kFMD));
+  const Bool_t needZDC   = (mask & (BIT(kZNA)|BIT(kZNC)|BIT(kZPA)|BIT(kZPC)|BIT(kZEMvsZDC))) || cleanData;
+  const Bool_t needMC    = (mask & BIT(kNPA));
+
   if (esd) {
     if (strcmp(esd->GetESDRun()->GetBeamType(), "A-A") == 0) runType=0;
     else runType=1;
@@ -1346,6 +1394,7 @@ void AliCentralitySelectionTask::UserExec(Option_t */*option*/)
   }
 
     // ***** V0 info    
+  StartCost();
   AliVVZERO* esdV0 = event->GetVZEROData();
   if (!esdV0) {
     AliError("AliVVZERO not available");
@@ -1408,6 +1457,9 @@ void AliCentralitySelectionTask::UserExec(Option_t */*option*/)
       multV0CEq += mult;
     }
   }
+  StopCost(kCostVZERO);
+
+  StartCost();
   Bool_t kT0BB = kFALSE;    
   if (esd) {
     // ***** T0 info    
@@ -1432,7 +1484,10 @@ void AliCentralitySelectionTask::UserExec(Option_t */*option*/)
     zvtxT0=esdT0->GetT0zVertex();
   }
 
+  StopCost(kCostT0);
+
   // ***** Trigger info    
+  StartCost();
   fIsSelected = ((esdV0->GetV0ADecision()==1) && (esdV0->GetV0CDecision()==1));
   TString trigStr;
   if (esd)
@@ -1482,17 +1537,23 @@ void AliCentralitySelectionTask::UserExec(Option_t */*option*/)
   if (kT0BB && fCVLNbit)
     fCSEMIbit=kTRUE;
 
-  if (esd) {  
+  StopCost(kCostTrigger);
+
+  StartCost();
+  if (needTRK && esd) {  
     // ***** CB info (tracklets, clusters, chips)
     //nTracks    = event->GetNumberOfTracks();     
     nTracks    = fTrackCuts ? (Short_t)fTrackCuts->GetReferenceMultiplicity(esd,kTRUE):-1;
-  } else {
+  } else if (needTRK) {
     AliAODHeader *h = dynamic_cast<AliAODHeader*>(aod->GetHeader());
     if(!h) AliFatal("Not a standard AOD");
     nTracks    = h!=0 ? (Short_t)h->GetTPConlyRefMultiplicity():-1;
   }
 
-  if (esd) {
+  StopCost(kCostTRK);
+
+  StartCost();
+  if (needCND && esd) {
     Short_t nTrTPCcandle = 0;
     for (Int_t iTracks = 0; iTracks < esd->GetNumberOfTracks(); iTracks++) {
 
@@ -1508,7 +1569,7 @@ void AliCentralitySelectionTask::UserExec(Option_t */*option*/)
       if (track->Pt() > 0.4 && TMath::Abs(track->Eta()) < 0.9)	nTrTPCcandle++;
     } 
     multCND = nTrTPCcandle;
-  } else {
+  } else if (needCND) {
     Short_t nTrTPCcandle = 0;
     for (Int_t iTracks = 0; iTracks < aod->GetNumberOfTracks(); iTracks++) {
 
@@ -1524,6 +1585,9 @@ void AliCentralitySelectionTask::UserExec(Option_t */*option*/)
     multCND = nTrTPCcandle;
   }
 
+  StopCost(kCostCND);
+
+  StartCost();
   if (esd) {
     const AliMultiplicity *mult = esd->GetMultiplicity();
     nTracklets = mult->GetNumberOfTracklets();
@@ -1545,8 +1609,10 @@ void AliCentralitySelectionTask::UserExec(Option_t */*option*/)
     }
   }
   spdCorr = AliESDUtils::GetCorrSPD2(nClusters[1],zvtx);
+  StopCost(kCostSPD);
   
-  if (esd) {
+  StartCost();
+  if (needFMD && esd) {
     // ***** FMD info
     AliESDFMD *fmd = esd->GetFMDData();
     Float_t totalMultA = 0;
@@ -1582,7 +1648,10 @@ void AliCentralitySelectionTask::UserExec(Option_t */*option*/)
     multFMDC = totalMultC;
   }
 
-  if (esd) {
+  StopCost(kCostFMD);
+
+  StartCost();
+  if (needZDC && esd) {
     // ***** ZDC info
     AliESDZDC *esdZDC = esd->GetESDZDC();
     zdcEnergyCal = esdZDC->AliESDZDC::TestBit(AliESDZDC::kEnergyCalibratedSignal);
@@ -1625,7 +1694,7 @@ void AliCentralitySelectionTask::UserExec(Option_t */*option*/)
     if (zpaFired) zpaTower = ZPAtower[0];
     if (zpcFired) zpcTower = ZPCtower[0];
 
-  } else {
+  } else if (needZDC) {
     AliAODHeader *h = dynamic_cast<AliAODHeader*>(aod->GetHeader());
     if(!h) AliFatal("Not a standard AOD");
     zncEnergy  = (Float_t) (h->GetZDCN1Energy());
@@ -1655,7 +1724,10 @@ void AliCentralitySelectionTask::UserExec(Option_t */*option*/)
     if (esdCent->GetCentralityPercentile("ZPC") != 101) zpcFired = kTRUE;
   }
 
-  if (esd) {
+  StopCost(kCostZDC);
+
+  StartCost();
+  if (needMC && esd) {
     // ***** MC info
     AliAnalysisManager* anMan = AliAnalysisManager::GetAnalysisManager();
     AliMCEventHandler* eventHandler = (AliMCEventHandler*)anMan->GetMCtruthEventHandler();
@@ -1683,6 +1755,8 @@ void AliCentralitySelectionTask::UserExec(Option_t */*option*/)
     }
   } 
 
+  StopCost(kCostMC);
+
   // ***** Scaling for MC
   if (fIsMCInput) {
     fUseScaling=kFALSE;
@@ -1699,61 +1773,64 @@ void AliCentralitySelectionTask::UserExec(Option_t */*option*/)
   }
 
   // ***** Centrality Selection
-  if(fHtempV0M) fCentV0M = fHtempV0M->GetBinContent(fHtempV0M->FindBin((v0Corr)));
-  if(fHtempV0A) fCentV0A = fHtempV0A->GetBinContent(fHtempV0A->FindBin((multV0ACorr)));
-  if(fHtempV0A0) fCentV0A0 = fHtempV0A0->GetBinContent(fHtempV0A0->FindBin((multV0A0Corr)));
-  if(fHtempV0A123) fCentV0A123 = fHtempV0A123->GetBinContent(fHtempV0A123->FindBin((multV0A123Corr)));
-  if(fHtempV0C) fCentV0C = fHtempV0C->GetBinContent(fHtempV0C->FindBin((multV0CCorr)));
-  if(fHtempV0A23) fCentV0A23 = fHtempV0A23->GetBinContent(fHtempV0A23->FindBin((multV0A23Corr)));
-  if(fHtempV0C01) fCentV0C01 = fHtempV0C01->GetBinContent(fHtempV0C01->FindBin((multV0C01Corr)));
-  if(fHtempV0S)  fCentV0S = fHtempV0S->GetBinContent(fHtempV0S->FindBin((multV0SCorr)));
-  if(fHtempV0MEq) fCentV0MEq = fHtempV0MEq->GetBinContent(fHtempV0MEq->FindBin((multV0AEq+multV0CEq)));
-  if(fHtempV0AEq) fCentV0AEq = fHtempV0AEq->GetBinContent(fHtempV0AEq->FindBin((multV0AEq)));
-  if(fHtempV0CEq) fCentV0CEq = fHtempV0CEq->GetBinContent(fHtempV0CEq->FindBin((multV0CEq)));
-  if(fHtempFMD) fCentFMD = fHtempFMD->GetBinContent(fHtempFMD->FindBin((multFMDA+multFMDC)));
-  if(fHtempTRK) fCentTRK = fHtempTRK->GetBinContent(fHtempTRK->FindBin(nTracks));
-  if(fHtempTKL) fCentTKL = fHtempTKL->GetBinContent(fHtempTKL->FindBin(nTracklets));
-  if(fHtempCL0) fCentCL0 = fHtempCL0->GetBinContent(fHtempCL0->FindBin(nClusters[0]));
-  if(fHtempCL1) fCentCL1 = fHtempCL1->GetBinContent(fHtempCL1->FindBin(spdCorr));
-  if(fHtempCND) fCentCND = fHtempCND->GetBinContent(fHtempCND->FindBin(multCND));
-  if(fHtempZNA) {
-    if(znaFired) fCentZNA = fHtempZNA->GetBinContent(fHtempZNA->FindBin(znaTower));
+  StartCost();
+  if(fHtempV0M && (mask & BIT(kV0M))) fCentV0M = LookupPercentile(kV0M,fHtempV0M,(v0Corr));
+  if(fHtempV0A && (mask & BIT(kV0A))) fCentV0A = LookupPercentile(kV0A,fHtempV0A,(multV0ACorr));
+  if(fHtempV0A0 && (mask & BIT(kV0A0))) fCentV0A0 = LookupPercentile(kV0A0,fHtempV0A0,(multV0A0Corr));
+  if(fHtempV0A123 && (mask & BIT(kV0A123))) fCentV0A123 = LookupPercentile(kV0A123,fHtempV0A123,(multV0A123Corr));
+  if(fHtempV0C && (mask & BIT(kV0C))) fCentV0C = LookupPercentile(kV0C,fHtempV0C,(multV0CCorr));
+  if(fHtempV0A23 && (mask & BIT(kV0A23))) fCentV0A23 = LookupPercentile(kV0A23,fHtempV0A23,(multV0A23Corr));
+  if(fHtempV0C01 && (mask & BIT(kV0C01))) fCentV0C01 = LookupPercentile(kV0C01,fHtempV0C01,(multV0C01Corr));
+  if(fHtempV0S && (mask & BIT(kV0S))) fCentV0S = LookupPercentile(kV0S,fHtempV0S,(multV0SCorr));
+  if(fHtempV0MEq && (mask & BIT(kV0MEq))) fCentV0MEq = LookupPercentile(kV0MEq,fHtempV0MEq,(multV0AEq+multV0CEq));
+  if(fHtempV0AEq && (mask & BIT(kV0AEq))) fCentV0AEq = LookupPercentile(kV0AEq,fHtempV0AEq,(multV0AEq));
+  if(fHtempV0CEq && (mask & BIT(kV0CEq))) fCentV0CEq = LookupPercentile(kV0CEq,fHtempV0CEq,(multV0CEq));
+  if(fHtempFMD && (mask & BIT(kFMD))) fCentFMD = LookupPercentile(kFMD,fHtempFMD,(multFMDA+multFMDC));
+  if(fHtempTRK && (mask & BIT(kTRK))) fCentTRK = LookupPercentile(kTRK,fHtempTRK,nTracks);
+  if(fHtempTKL && (mask & BIT(kTKL))) fCentTKL = LookupPercentile(kTKL,fHtempTKL,nTracklets);
+  if(fHtempCL0 && (mask & BIT(kCL0))) fCentCL0 = LookupPercentile(kCL0,fHtempCL0,nClusters[0]);
+  if(fHtempCL1 && (mask & BIT(kCL1))) fCentCL1 = LookupPercentile(kCL1,fHtempCL1,spdCorr);
+  if(fHtempCND && (mask & BIT(kCND))) fCentCND = LookupPercentile(kCND,fHtempCND,multCND);
+  if(fHtempZNA && (mask & BIT(kZNA))) {
+    if(znaFired) fCentZNA = LookupPercentile(kZNA,fHtempZNA,znaTower);
     else fCentZNA = 101;
   }
-  if(fHtempZNC) {
-    if(zncFired) fCentZNC = fHtempZNC->GetBinContent(fHtempZNC->FindBin(zncTower));
+  if(fHtempZNC && (mask & BIT(kZNC))) {
+    if(zncFired) fCentZNC = LookupPercentile(kZNC,fHtempZNC,zncTower);
     else fCentZNC = 101;
   }
-  if(fHtempZPA) {
-    if(znaFired) fCentZPA = fHtempZPA->GetBinContent(fHtempZPA->FindBin(zpaTower));
+  if(fHtempZPA && (mask & BIT(kZPA))) {
+    if(znaFired) fCentZPA = LookupPercentile(kZPA,fHtempZPA,zpaTower);
     else fCentZPA = 101;
   }
-  if(fHtempZPC) {
-    if(zpcFired) fCentZPC = fHtempZPC->GetBinContent(fHtempZPC->FindBin(zpcTower));
+  if(fHtempZPC && (mask & BIT(kZPC))) {
+    if(zpcFired) fCentZPC = LookupPercentile(kZPC,fHtempZPC,zpcTower);
     else fCentZPC = 101;
   }
 
 
-  if(fHtempV0MvsFMD) fCentV0MvsFMD = fHtempV0MvsFMD->GetBinContent(fHtempV0MvsFMD->FindBin((multV0A+multV0C)));
-  if(fHtempTKLvsV0M) fCentTKLvsV0M = fHtempTKLvsV0M->GetBinContent(fHtempTKLvsV0M->FindBin(nTracklets));
-  if(fHtempZEMvsZDC) fCentZEMvsZDC = fHtempZEMvsZDC->GetBinContent(fHtempZEMvsZDC->FindBin(zem1Energy+zem2Energy,zncEnergy+znaEnergy+zpcEnergy+zpaEnergy));
-
-  if(fHtempNPA) fCentNPA = fHtempNPA->GetBinContent(fHtempNPA->FindBin(Npart));
-  if(fHtempV0Mtrue) fCentV0Mtrue = fHtempV0Mtrue->GetBinContent(fHtempV0Mtrue->FindBin((multV0ACorr+multV0CCorr)));
-  if(fHtempV0Atrue) fCentV0Atrue = fHtempV0Atrue->GetBinContent(fHtempV0Atrue->FindBin((multV0ACorr)));
-  if(fHtempV0Ctrue) fCentV0Ctrue = fHtempV0Ctrue->GetBinContent(fHtempV0Ctrue->FindBin((multV0CCorr)));
-  if(fHtempV0MEqtrue) fCentV0MEqtrue = fHtempV0MEqtrue->GetBinContent(fHtempV0MEqtrue->FindBin((multV0AEq+multV0CEq)));
-  if(fHtempV0AEqtrue) fCentV0AEqtrue = fHtempV0AEqtrue->GetBinContent(fHtempV0AEqtrue->FindBin((multV0AEq)));
-  if(fHtempV0CEqtrue) fCentV0CEqtrue = fHtempV0CEqtrue->GetBinContent(fHtempV0CEqtrue->FindBin((multV0CEq)));
-  if(fHtempFMDtrue) fCentFMDtrue = fHtempFMDtrue->GetBinContent(fHtempFMDtrue->FindBin((multFMDA+multFMDC)));
-  if(fHtempTRKtrue) fCentTRKtrue = fHtempTRKtrue->GetBinContent(fHtempTRKtrue->FindBin(nTracks));
-  if(fHtempTKLtrue) fCentTKLtrue = fHtempTKLtrue->GetBinContent(fHtempTKLtrue->FindBin(nTracklets));
-  if(fHtempCL0true) fCentCL0true = fHtempCL0true->GetBinContent(fHtempCL0true->FindBin(nClusters[0]));
-  if(fHtempCL1true) fCentCL1true = fHtempCL1true->GetBinContent(fHtempCL1true->FindBin(spdCorr));
-  if(fHtempCNDtrue) fCentCNDtrue = fHtempCNDtrue->GetBinContent(fHtempCNDtrue->FindBin(multCND));
-  if(fHtempZNAtrue) fCentZNAtrue = fHtempZNAtrue->GetBinContent(fHtempZNAtrue->FindBin(znaTower));
-  if(fHtempZNCtrue) fCentZNCtrue = fHtempZNCtrue->GetBinContent(fHtempZNCtrue->FindBin(zncTower));
-   
+  if(fHtempV0MvsFMD && (mask & BIT(kV0MvsFMD))) fCentV0MvsFMD = LookupPercentile(kV0MvsFMD,fHtempV0MvsFMD,(multV0A+multV0C));
+  if(fHtempTKLvsV0M && (mask & BIT(kTKLvsV0M))) fCentTKLvsV0M = LookupPercentile(kTKLvsV0M,fHtempTKLvsV0M,nTracklets);
+  if(fHtempZEMvsZDC && (mask & BIT(kZEMvsZDC))) fCentZEMvsZDC = fHtempZEMvsZDC->GetBinContent(fHtempZEMvsZDC->FindBin(zem1Energy+zem2Energy,zncEnergy+znaEnergy+zpcEnergy+zpaEnergy));
+
+  if(fHtempNPA && (mask & BIT(kNPA))) fCentNPA = LookupPercentile(kNPA,fHtempNPA,Npart);
+  if (fFillHistos) { // true centralities only enter the QA histograms
+    if(fHtempV0Mtrue) fCentV0Mtrue = fHtempV0Mtrue->GetBinContent(fHtempV0Mtrue->FindBin((multV0ACorr+multV0CCorr)));
+    if(fHtempV0Atrue) fCentV0Atrue = fHtempV0Atrue->GetBinContent(fHtempV0Atrue->FindBin((multV0ACorr)));
+    if(fHtempV0Ctrue) fCentV0Ctrue = fHtempV0Ctrue->GetBinContent(fHtempV0Ctrue->FindBin((multV0CCorr)));
+    if(fHtempV0MEqtrue) fCentV0MEqtrue = fHtempV0MEqtrue->GetBinContent(fHtempV0MEqtrue->FindBin((multV0AEq+multV0CEq)));
+    if(fHtempV0AEqtrue) fCentV0AEqtrue = fHtempV0AEqtrue->GetBinContent(fHtempV0AEqtrue->FindBin((multV0AEq)));
+    if(fHtempV0CEqtrue) fCentV0CEqtrue = fHtempV0CEqtrue->GetBinContent(fHtempV0CEqtrue->FindBin((multV0CEq)));
+    if(fHtempFMDtrue) fCentFMDtrue = fHtempFMDtrue->GetBinContent(fHtempFMDtrue->FindBin((multFMDA+multFMDC)));
+    if(fHtempTRKtrue) fCentTRKtrue = fHtempTRKtrue->GetBinContent(fHtempTRKtrue->FindBin(nTracks));
+    if(fHtempTKLtrue) fCentTKLtrue = fHtempTKLtrue->GetBinContent(fHtempTKLtrue->FindBin(nTracklets));
+    if(fHtempCL0true) fCentCL0true = fHtempCL0true->GetBinContent(fHtempCL0true->FindBin(nClusters[0]));
+    if(fHtempCL1true) fCentCL1true = fHtempCL1true->GetBinContent(fHtempCL1true->FindBin(spdCorr));
+    if(fHtempCNDtrue) fCentCNDtrue = fHtempCNDtrue->GetBinContent(fHtempCNDtrue->FindBin(multCND));
+    if(fHtempZNAtrue) fCentZNAtrue = fHtempZNAtrue->GetBinContent(fHtempZNAtrue->FindBin(znaTower));
+    if(fHtempZNCtrue) fCentZNCtrue = fHtempZNCtrue->GetBinContent(fHtempZNCtrue->FindBin(zncTower));
+  }
+  StopCost(kCostPercentiles);
 
   // ***** Cleaning
   if (fUseCleaning) {
@@ -1791,31 +1868,31 @@ void AliCentralitySelectionTask::UserExec(Option_t */*option*/)
 	     fCentTRK!=0?trk/fCentTRK:1, cnd, fCentCND, fCentCND!=0?cnd/fCentCND:1, zna, fCentZNA, fCentZNA!=0?zna/fCentZNA:1);
     }
     esdCent->SetQuality(fQuality);
-    esdCent->SetCentralityV0M(fCentV0M);
-    esdCent->SetCentralityV0A(fCentV0A);
-    esdCent->SetCentralityV0A0(fCentV0A0);
-    esdCent->SetCentralityV0A123(fCentV0A123);
-    esdCent->SetCentralityV0C(fCentV0C);
-    esdCent->SetCentralityV0A23(fCentV0A23);
-    esdCent->SetCentralityV0C01(fCentV0C01);
-    esdCent->SetCentralityV0S(fCentV0S);
-    esdCent->SetCentralityV0MEq(fCentV0MEq);
-    esdCent->SetCentralityV0AEq(fCentV0AEq);
-    esdCent->SetCentralityV0CEq(fCentV0CEq);
-    esdCent->SetCentralityFMD(fCentFMD);
-    esdCent->SetCentralityTRK(fCentTRK);
-    esdCent->SetCentralityTKL(fCentTKL);
-    esdCent->SetCentralityCL0(fCentCL0);
-    esdCent->SetCentralityCL1(fCentCL1);
-    esdCent->SetCentralityCND(fCentCND);
-    esdCent->SetCentralityNPA(fCentNPA);
-    esdCent->SetCentralityZNA(fCentZNA);
-    esdCent->SetCentralityZNC(fCentZNC);
-    esdCent->SetCentralityZPA(fCentZPA);
-    esdCent->SetCentralityZPC(fCentZPC);
-    esdCent->SetCentralityV0MvsFMD(fCentV0MvsFMD);
-    esdCent->SetCentralityTKLvsV0M(fCentTKLvsV0M);
-    esdCent->SetCentralityZEMvsZDC(fCentZEMvsZDC);
+    if (mask & BIT(kV0M)) esdCent->SetCentralityV0M(fCentV0M);
+    if (mask & BIT(kV0A)) esdCent->SetCentralityV0A(fCentV0A);
+    if (mask & BIT(kV0A0)) esdCent->SetCentralityV0A0(fCentV0A0);
+    if (mask & BIT(kV0A123)) esdCent->SetCentralityV0A123(fCentV0A123);
+    if (mask & BIT(kV0C)) esdCent->SetCentralityV0C(fCentV0C);
+    if (mask & BIT(kV0A23)) esdCent->SetCentralityV0A23(fCentV0A23);
+    if (mask & BIT(kV0C01)) esdCent->SetCentralityV0C01(fCentV0C01);
+    if (mask & BIT(kV0S)) esdCent->SetCentralityV0S(fCentV0S);
+    if (mask & BIT(kV0MEq)) esdCent->SetCentralityV0MEq(fCentV0MEq);
+    if (mask & BIT(kV0AEq)) esdCent->SetCentralityV0AEq(fCentV0AEq);
+    if (mask & BIT(kV0CEq)) esdCent->SetCentralityV0CEq(fCentV0CEq);
+    if (mask & BIT(kFMD)) esdCent->SetCentralityFMD(fCentFMD);
+    if (mask & BIT(kTRK)) esdCent->SetCentralityTRK(fCentTRK);
+    if (mask & BIT(kTKL)) esdCent->SetCentralityTKL(fCentTKL);
+    if (mask & BIT(kCL0)) esdCent->SetCentralityCL0(fCentCL0);
+    if (mask & BIT(kCL1)) esdCent->SetCentralityCL1(fCentCL1);
+    if (mask & BIT(kCND)) esdCent->SetCentralityCND(fCentCND);
+    if (mask & BIT(kNPA)) esdCent->SetCentralityNPA(fCentNPA);
+    if (mask & BIT(kZNA)) esdCent->SetCentralityZNA(fCentZNA);
+    if (mask & BIT(kZNC)) esdCent->SetCentralityZNC(fCentZNC);
+    if (mask & BIT(kZPA)) esdCent->SetCentralityZPA(fCentZPA);
+    if (mask & BIT(kZPC)) esdCent->SetCentralityZPC(fCentZPC);
+    if (mask & BIT(kV0MvsFMD)) esdCent->SetCentralityV0MvsFMD(fCentV0MvsFMD);
+    if (mask & BIT(kTKLvsV0M)) esdCent->SetCentralityTKLvsV0M(fCentTKLvsV0M);
+    if (mask & BIT(kZEMvsZDC)) esdCent->SetCentralityZEMvsZDC(fCentZEMvsZDC);
   }
 
   // filling QA histograms
@@ -2157,11 +2234,94 @@ Int_t AliCentralitySelectionTask::SetupRun(const AliVEvent* const esd)
   fV0MZDCEcalOutlierPar0 =  centOADB->V0MZDCEcalOutlierPar0();  
   fV0MZDCEcalOutlierPar1 =  centOADB->V0MZDCEcalOutlierPar1();  
 
+  BuildPercentileTables();
+
   return 0;
 }
 
 
 
+//________________________________________________________________________
+void AliCentralitySelectionTask::SetEstimators(const char* list)
+{
+  // Restrict the evaluation to the estimators in the list, e.g. "V0M CL1 TRK".
+  // The other estimators of AliCentrality are left untouched. All estimators
+  // are evaluated when the QA histos are filled, V0M is always evaluated
+  // when the cleaning is enabled.
+  fEstimatorMask = 0;
+  TString str(list);
+  TObjArray *tokens = str.Tokenize(" ,;");
+  for (Int_t i=0; i<tokens->GetEntriesFast(); i++) {
+    TString name = ((TObjString*)tokens->At(i))->GetString();
+    Int_t est = 0;
+    while (est<kNEstimators && name.CompareTo(fgkEstimatorNames[est])!=0) est++;
+    if (est<kNEstimators) fEstimatorMask |= BIT(est);
+    else AliError(Form("Unknown centrality estimator %s",name.Data()));
+  }
+  delete tokens;
+}
+
+//________________________________________________________________________
+UInt_t AliCentralitySelectionTask::GetEffectiveEstimatorMask() const
+{
+  // Estimators evaluated for the current event
+  if (fFillHistos) return 0xffffffff;
+  UInt_t mask = fEstimatorMask;
+  if (fUseCleaning) mask |= BIT(kV0M);
+  return mask;
+}
+
+//________________________________________________________________________
+void AliCentralitySelectionTask::BuildPercentileTables()
+{
+  // Copy the percentiles of the equidistant 1D calibration histos of the
+  // run in flat tables, so that the lookup is a single multiply and load.
+  // Histos with variable bins are looked up with FindBin.
+  TH1F *hists[kNEstimators] = {fHtempV0M, fHtempV0A, fHtempV0A0, fHtempV0A123, fHtempV0C,
+                               fHtempV0A23, fHtempV0C01, fHtempV0S, fHtempV0MEq, fHtempV0AEq,
+                               fHtempV0CEq, fHtempFMD, fHtempTRK, fHtempTKL, fHtempCL0,
+                               fHtempCL1, fHtempCND, fHtempZNA, fHtempZNC, fHtempZPA,
+                               fHtempZPC, fHtempNPA, fHtempV0MvsFMD, fHtempTKLvsV0M, 0x0};
+  Int_t size = 0;
+  for (Int_t i=0; i<kNEstimators; i++) {
+    TH1F *h = hists[i];
+    fTableNbins[i]  = 0;
+    fTableOffset[i] = size;
+    if (!h || h->GetXaxis()->GetXbins()->GetSize()>0) continue;
+    fTableNbins[i] = h->GetNbinsX();
+    fTableXmin[i]  = h->GetXaxis()->GetXmin();
+    fTableXmax[i]  = h->GetXaxis()->GetXmax();
+    size += fTableNbins[i]+2;
+  }
+  fTableContent.Set(size);
+  for (Int_t i=0; i<kNEstimators; i++) {
+    for (Int_t ib=0; ib<fTableNbins[i]+2; ib++)
+      fTableContent[fTableOffset[i]+ib] = hists[i]->GetBinContent(ib);
+  }
+}
+
+//________________________________________________________________________
+Float_t AliCentralitySelectionTask::LookupPercentile(Int_t est, const TH1F* h, Double_t x) const
+{
+  // Percentile for the multiplicity x, same bin as TAxis::FindFixBin
+  const Int_t nbins = fTableNbins[est];
+  if (nbins<=0) return h->GetBinContent(h->FindBin(x));
+  Int_t bin;
+  if (x<fTableXmin[est]) bin = 0;
+  else if (!(x<fTableXmax[est])) bin = nbins+1;
+  else bin = 1 + Int_t(nbins*(x-fTableXmin[est])/(fTableXmax[est]-fTableXmin[est]));
+  return fTableContent[fTableOffset[est]+bin];
+}
+
+//________________________________________________________________________
+void AliCentralitySelectionTask::StopCost(Int_t block)
+{
+  // Add the time spent since StartCost() to the given input
+  if (!fHOutInputCost) return;
+  fCostWatch.Stop();
+  fHOutInputCost->Fill(block,1.e6*fCostWatch.RealTime());
+}
+
 //________________________________________________________________________
 Bool_t AliCentralitySelectionTask::IsOutlierV0MSPD(Float_t spd, Float_t v0, Int_t cent) const
 {
@@ -9,6 +9,8 @@
 //   author: Alberica Toia
 //*****************************************************
 
+#include <TArrayF.h>
+#include <TStopwatch.h>
 #include "AliAnalysisTaskSE.h"
 
 class TFile;
@@ -24,6 +26,13 @@ class AliCentralitySelectionTask : public AliAnalysisTaskSE {
 
  public:
 
+  enum ECentEstimator { kV0M=0, kV0A, kV0A0, kV0A123, kV0C, kV0A23, kV0C01, kV0S,
+                        kV0MEq, kV0AEq, kV0CEq, kFMD, kTRK, kTKL, kCL0, kCL1, kCND,
+                        kZNA, kZNC, kZPA, kZPC, kNPA, kV0MvsFMD, kTKLvsV0M, kZEMvsZDC,
+                        kNEstimators };
+  enum EInputCost { kCostVZERO=0, kCostT0, kCostTrigger, kCostTRK, kCostCND, kCostSPD,
+                    kCostFMD, kCostZDC, kCostMC, kCostPercentiles, kNCostBlocks };
+
   AliCentralitySelectionTask();
   AliCentralitySelectionTask(const char *name);
   AliCentralitySelectionTask& operator= (const AliCentralitySelectionTask& ana);
@@ -41,6 +50,9 @@ class AliCentralitySelectionTask : public AliAnalysisTaskSE {
   void DontUseCleaning()                   {fUseCleaning=kFALSE;}
   void SetFillHistos()                     {fFillHistos=kTRUE; DefineOutput(1, TList::Class());
 }
+  void SetEstimators(const char* list);
+  void SetMeasureCost(Bool_t flag=kTRUE)   {fMeasureCost=flag;}
+  static const char* GetEstimatorName(Int_t est) {return (est>=0 && est<kNEstimators) ? fgkEstimatorNames[est] : "";}
 
  private:
 
@@ -49,6 +61,13 @@ class AliCentralitySelectionTask : public AliAnalysisTaskSE {
   Bool_t IsOutlierV0MTPC(Int_t tracks, Float_t v0, Int_t cent) const;
   Bool_t IsOutlierV0MZDC(Float_t zdc, Float_t v0) const;
   Bool_t IsOutlierV0MZDCECal(Float_t zdc, Float_t v0) const;
+  UInt_t  GetEffectiveEstimatorMask() const;
+  void    BuildPercentileTables();
+  Float_t LookupPercentile(Int_t est, const TH1F* h, Double_t x) const;
+  void    StartCost()              {if (fHOutInputCost) fCostWatch.Start(kTRUE);}
+  void    StopCost(Int_t block);
+
+  static const char* fgkEstimatorNames[kNEstimators]; // names of the estimators, as in AliCentrality
 
   TString  fAnalysisInput; 	// "ESD", "AOD"
   Bool_t   fIsMCInput;          // true when input is MC
@@ -56,6 +75,8 @@ class AliCentralitySelectionTask : public AliAnalysisTaskSE {
   Bool_t   fUseScaling;         // flag to use scaling 
   Bool_t   fUseCleaning;        // flag to use cleaning  
   Bool_t   fFillHistos;         // flag to fill the QA histos
+  UInt_t   fEstimatorMask;      // estimators to be evaluated (bits of ECentEstimator)
+  Bool_t   fMeasureCost;        // flag to fill the time spent per input in the QA histos
   Float_t  fV0MScaleFactor;     // scale factor V0M
   Float_t  fSPDScaleFactor;     // scale factor SPD
   Float_t  fTPCScaleFactor;     // scale factor TPC
@@ -192,6 +213,13 @@ class AliCentralitySelectionTask : public AliAnalysisTaskSE {
   TH1F    *fHtempZPAtrue;       // histogram with centrality true (sim) vs multiplicity using ZPA
   TH1F    *fHtempZPCtrue;       // histogram with centrality true (sim) vs multiplicity using ZPC
 
+  Int_t    fTableNbins[kNEstimators];  //! percentile tables of the run: number of bins (0 if not tabulated)
+  Int_t    fTableOffset[kNEstimators]; //! percentile tables of the run: offset in fTableContent
+  Double_t fTableXmin[kNEstimators];   //! percentile tables of the run: lower edge
+  Double_t fTableXmax[kNEstimators];   //! percentile tables of the run: upper edge
+  TArrayF  fTableContent;              //! percentile tables of the run, including under- and overflow
+  TStopwatch fCostWatch;               //! timer for the input cost
+
   TList   *fOutputList; // output list
   
 
@@ -325,8 +353,9 @@ class AliCentralitySelectionTask : public AliAnalysisTaskSE {
   TH1F *fHOutQuality ;          //control histogram for quality
   TH1F *fHOutVertex ;           //control histogram for vertex SPD
   TH1F *fHOutVertexT0 ;         //control histogram for vertex T0
+  TH1F *fHOutInputCost ;        //control histogram for the time spent per input (us)
 
-  ClassDef(AliCentralitySelectionTask, 31); 
+  ClassDef(AliCentralitySelectionTask, 32); 
 };
 
 #endif
@@ -0,0 +1,121 @@
+/**************************************************************************
+ * Copyright(c) 1998-2008, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+//*****************************************************
+//   Class AliEPQVectors
+//   Q-vectors of the event for harmonics 1-6
+//*****************************************************
+
+#include <TMath.h>
+#include "AliVEvent.h"
+#include "AliEPQVectors.h"
+
+ClassImp(AliEPQVectors)
+
+//________________________________________________________________________
+AliEPQVectors::AliEPQVectors():
+  TNamed(GetStdName(),GetStdName()),
+  fRecentered(0)
+{
+  // Default constructor
+  Reset();
+}
+
+//________________________________________________________________________
+AliEPQVectors::AliEPQVectors(const char* name):
+  TNamed(name,name),
+  fRecentered(0)
+{
+  // Constructor
+  Reset();
+}
+
+//________________________________________________________________________
+AliEPQVectors::AliEPQVectors(const AliEPQVectors& q):
+  TNamed(q),
+  fRecentered(q.fRecentered)
+{
+  // Copy constructor
+  for (Int_t id = 0; id < kNDetectors; id++) {
+    for (Int_t ih = 0; ih < kNHarmonics; ih++) {
+      fQx[id][ih] = q.fQx[id][ih];
+      fQy[id][ih] = q.fQy[id][ih];
+    }
+    fSumW[id] = q.fSumW[id];
+    fMult[id] = q.fMult[id];
+  }
+}
+
+//________________________________________________________________________
+AliEPQVectors& AliEPQVectors::operator=(const AliEPQVectors& q)
+{
+  // Assignment operator
+  if (this != &q) {
+    TNamed::operator=(q);
+    for (Int_t id = 0; id < kNDetectors; id++) {
+      for (Int_t ih = 0; ih < kNHarmonics; ih++) {
+        fQx[id][ih] = q.fQx[id][ih];
+        fQy[id][ih] = q.fQy[id][ih];
+      }
+      fSumW[id] = q.fSumW[id];
+      fMult[id] = q.fMult[id];
+    }
+    fRecentered = q.fRecentered;
+  }
+  return *this;
+}
+
+//________________________________________________________________________
+AliEPQVectors* AliEPQVectors::FromEvent(const TObject* event)
+{
+  // Q-vectors attached to the event by AliEPSelectionTask, 0 if not available
+  const AliVEvent* ev = dynamic_cast<const AliVEvent*>(event);
+  if (!ev) return 0;
+  return dynamic_cast<AliEPQVectors*>(ev->FindListObject(GetStdName()));
+}
+
+//________________________________________________________________________
+void AliEPQVectors::Reset()
+{
+  // Clear the Q-vectors
+  for (Int_t id = 0; id < kNDetectors; id++) {
+    for (Int_t ih = 0; ih < kNHarmonics; ih++) {
+      fQx[id][ih] = 0.;
+      fQy[id][ih] = 0.;
+    }
+    fSumW[id] = 0.;
+    fMult[id] = 0;
+  }
+  fRecentered = 0;
+}
+
+//________________________________________________________________________
+void AliEPQVectors::SetQ(Int_t det, Int_t harmonic, Double_t qx, Double_t qy, Bool_t recentered)
+{
+  // Set the Q-vector of a detector for harmonic 1-6
+  fQx[det][harmonic-1] = qx;
+  fQy[det][harmonic-1] = qy;
+  if (recentered) SETBIT(fRecentered,det*kNHarmonics+harmonic-1);
+  else CLRBIT(fRecentered,det*kNHarmonics+harmonic-1);
+}
+
+//________________________________________________________________________
+Double_t AliEPQVectors::GetEventPlane(Int_t det, Int_t harmonic) const
+{
+  // Event plane angle of the given harmonic, in [0,2pi/harmonic)
+  Double_t psi = TMath::ATan2(fQy[det][harmonic-1],fQx[det][harmonic-1]);
+  if (psi < 0) psi += TMath::TwoPi();
+  return psi/harmonic;
+}
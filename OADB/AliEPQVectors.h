@@ -0,0 +1,55 @@
+#ifndef ALIEPQVECTORS_H
+#define ALIEPQVECTORS_H
+
+/* Copyright(c) 1998-2008, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+//*****************************************************
+//   Class AliEPQVectors
+//   Q-vectors of the event for harmonics 1-6, computed
+//   once per event by AliEPSelectionTask and attached
+//   to the input event for all the other tasks
+//*****************************************************
+
+#include <TNamed.h>
+
+class AliEPQVectors : public TNamed {
+
+ public:
+
+  enum EDetector {kTPC=0, kV0A, kV0C, kNDetectors};
+  enum {kNHarmonics=6};
+
+  AliEPQVectors();
+  AliEPQVectors(const char* name);
+  AliEPQVectors(const AliEPQVectors& q);
+  AliEPQVectors& operator= (const AliEPQVectors& q);
+  virtual ~AliEPQVectors() {}
+
+  static const char* GetStdName()            {return "EPQVectors";}
+  static AliEPQVectors* FromEvent(const TObject* event);
+
+  void     Reset();
+  void     SetQ(Int_t det, Int_t harmonic, Double_t qx, Double_t qy, Bool_t recentered=kFALSE);
+  void     SetSumOfWeights(Int_t det, Double_t sumw) {fSumW[det] = sumw;}
+  void     SetMultiplicity(Int_t det, Int_t mult)    {fMult[det] = mult;}
+
+  Double_t GetQx(Int_t det, Int_t harmonic) const   {return fQx[det][harmonic-1];}
+  Double_t GetQy(Int_t det, Int_t harmonic) const   {return fQy[det][harmonic-1];}
+  Double_t GetSumOfWeights(Int_t det) const         {return fSumW[det];}
+  Int_t    GetMultiplicity(Int_t det) const         {return fMult[det];}
+  Double_t GetEventPlane(Int_t det, Int_t harmonic) const;
+  Bool_t   IsRecentered(Int_t det, Int_t harmonic) const {return TESTBIT(fRecentered,det*kNHarmonics+harmonic-1);}
+
+ private:
+
+  Double_t fQx[kNDetectors][kNHarmonics];   // x component of the Q-vectors
+  Double_t fQy[kNDetectors][kNHarmonics];   // y component of the Q-vectors
+  Double_t fSumW[kNDetectors];              // sum of the weights per detector
+  Int_t    fMult[kNDetectors];              // number of tracks or channels with signal
+  UInt_t   fRecentered;                     // bit det*kNHarmonics+harmonic-1 set if recentered
+
+  ClassDef(AliEPQVectors,1);
+};
+
+#endif
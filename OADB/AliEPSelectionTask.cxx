@@ -60,6 +60,7 @@
 #include "AliVTrack.h"
 #include "AliMultSelection.h"
 #include "AliEventplane.h"
+#include "AliEPQVectors.h"
 
 using std::cout;
 using std::endl;
@@ -83,12 +84,17 @@ AliAnalysisTaskSE(),
   fAODfilterbit(1),
   fEtaGap(0.),
   fSplitMethod(0),
+  fComputeQVectors(kFALSE),
   fESDtrackCuts(0),
   fEPContainer(0),
   fQxContainer(0),
   fQyContainer(0),
   fSparseDist(0),
   fHruns(0),
+  fCachedTrackList(0),
+  fTrackWeight(),
+  fTrackCos2(),
+  fTrackSin2(),
   fQVector(0),
   fQContributionX(0),
   fQContributionY(0),
@@ -134,12 +140,17 @@ AliEPSelectionTask::AliEPSelectionTask(const char *name):
   fAODfilterbit(1),
   fEtaGap(0.),
   fSplitMethod(0),
+  fComputeQVectors(kFALSE),
   fESDtrackCuts(0),
   fEPContainer(0),
   fQxContainer(0),
   fQyContainer(0),
   fSparseDist(0),
   fHruns(0),
+  fCachedTrackList(0),
+  fTrackWeight(),
+  fTrackCos2(),
+  fTrackSin2(),
   fQVector(0),
   fQContributionX(0),
   fQContributionY(0),
@@ -294,6 +305,7 @@ void AliEPSelectionTask::UserExec(Option_t */*option*/)
 
       if (nt>4){
 
+	CacheTracks(tracklist);
 	// qvector full event
 	fQVector = new TVector2(GetQ(esdEP,tracklist));
 	fEventplaneQ = fQVector->Phi()/2;
@@ -333,6 +345,8 @@ void AliEPSelectionTask::UserExec(Option_t */*option*/)
 	}
 	fHOutleadPTPsi->Fill(trmax->Phi(),fEventplaneQ);
       }
+      if (fComputeQVectors) FillQVectors(esd,tracklist);
+      ClearTrackCache();
       tracklist->Clear();
       delete tracklist;
       tracklist = 0;
@@ -388,6 +402,7 @@ void AliEPSelectionTask::UserExec(Option_t */*option*/)
 
       if (NT>4){
 
+	CacheTracks(tracklist);
 	// qvector full event
 	fQVector = new TVector2(GetQ(esdEP,tracklist));
 	fEventplaneQ = fQVector->Phi()/2;
@@ -428,6 +443,8 @@ void AliEPSelectionTask::UserExec(Option_t */*option*/)
 	}
 	fHOutleadPTPsi->Fill(trmax->Phi(),fEventplaneQ);
       }
+      if (fComputeQVectors) FillQVectors(aod,tracklist);
+      ClearTrackCache();
       delete tracklist;
       tracklist = 0;
     }
@@ -464,20 +481,24 @@ TVector2 AliEPSelectionTask::GetQ(AliEventplane* EP, TObjArray* tracklist)
   Recenter(1, rms);
 
   int nt = tracklist->GetEntries();
+  // weights and cos/sin(2 phi) computed once per event in CacheTracks
+  const Bool_t cached = (tracklist == fCachedTrackList);
 
   for (int i=0; i<nt; i++){
     weight = 1;
     track = dynamic_cast<AliVTrack*> (tracklist->At(i));
     if (track) {
-      weight = GetWeight(track);
+      weight = cached ? fTrackWeight[i] : GetWeight(track);
+      const Double_t cos2 = cached ? fTrackCos2[i] : cos(2*track->Phi());
+      const Double_t sin2 = cached ? fTrackSin2[i] : sin(2*track->Phi());
     if (fSaveTrackContribution){
       idtemp = track->GetID();
       if ((fAnalysisInput.CompareTo("AOD")==0) && (fAODfilterbit == 128)) idtemp = idtemp*(-1) - 1;
-      EP->GetQContributionXArray()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-      EP->GetQContributionYArray()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
+      EP->GetQContributionXArray()->AddAt(weight*cos2/rms[0],idtemp);
+      EP->GetQContributionYArray()->AddAt(weight*sin2/rms[1],idtemp);
      }
-     mQx += (weight*cos(2*track->Phi())/rms[0]);
-     mQy += (weight*sin(2*track->Phi())/rms[1]);
+     mQx += (weight*cos2/rms[0]);
+     mQy += (weight*sin2/rms[1]);
     }
   }
   mQ.Set(mQx-(mean[0]/rms[0]), mQy-(mean[1]/rms[1]));
@@ -500,6 +521,8 @@ void AliEPSelectionTask::GetQsub(TVector2 &Q1, TVector2 &Q2, TObjArray* tracklis
   TRandom2 rn = 0;
 
   int nt = tracklist->GetEntries();
+  // weights and cos/sin(2 phi) computed once per event in CacheTracks
+  const Bool_t cached = (tracklist == fCachedTrackList);
   int trackcounter1=0, trackcounter2=0;
   int idtemp = 0;
 
@@ -509,7 +532,9 @@ void AliEPSelectionTask::GetQsub(TVector2 &Q1, TVector2 &Q2, TObjArray* tracklis
       weight = 1;
       track = dynamic_cast<AliVTrack*> (tracklist->At(i));
       if (!track) continue;
-      weight = GetWeight(track);
+      weight = cached ? fTrackWeight[i] : GetWeight(track);
+      const Double_t cos2 = cached ? fTrackCos2[i] : cos(2*track->Phi());
+      const Double_t sin2 = cached ? fTrackSin2[i] : sin(2*track->Phi());
       idtemp = track->GetID();
       if ((fAnalysisInput.CompareTo("AOD")==0) && (fAODfilterbit == 128)) idtemp = idtemp*(-1) - 1;
 
@@ -517,39 +542,39 @@ void AliEPSelectionTask::GetQsub(TVector2 &Q1, TVector2 &Q2, TObjArray* tracklis
       if( trackcounter1 < int(nt/2.) && trackcounter2 < int(nt/2.)){
         float random = rn.Rndm();
         if(random < .5){
-          mQx1 += (weight*cos(2*track->Phi())/rms[0]);
-          mQy1 += (weight*sin(2*track->Phi())/rms[1]);
+          mQx1 += (weight*cos2/rms[0]);
+          mQy1 += (weight*sin2/rms[1]);
           if (fSaveTrackContribution){
-            EP->GetQContributionXArraysub1()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-            EP->GetQContributionYArraysub1()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
+            EP->GetQContributionXArraysub1()->AddAt(weight*cos2/rms[0],idtemp);
+            EP->GetQContributionYArraysub1()->AddAt(weight*sin2/rms[1],idtemp);
           }
           trackcounter1++;
         }
         else {
-          mQx2 += (weight*cos(2*track->Phi())/rms[0]);
-          mQy2 += (weight*sin(2*track->Phi())/rms[1]);
+          mQx2 += (weight*cos2/rms[0]);
+          mQy2 += (weight*sin2/rms[1]);
           if (fSaveTrackContribution){
-            EP->GetQContributionXArraysub2()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-            EP->GetQContributionYArraysub2()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
+            EP->GetQContributionXArraysub2()->AddAt(weight*cos2/rms[0],idtemp);
+            EP->GetQContributionYArraysub2()->AddAt(weight*sin2/rms[1],idtemp);
           }
           trackcounter2++;
         }
       }
       else if( trackcounter1 >= int(nt/2.)){
-        mQx2 += (weight*cos(2*track->Phi())/rms[0]);
-        mQy2 += (weight*sin(2*track->Phi())/rms[1]);
+        mQx2 += (weight*cos2/rms[0]);
+        mQy2 += (weight*sin2/rms[1]);
         if (fSaveTrackContribution){
-          EP->GetQContributionXArraysub2()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-          EP->GetQContributionYArraysub2()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
+          EP->GetQContributionXArraysub2()->AddAt(weight*cos2/rms[0],idtemp);
+          EP->GetQContributionYArraysub2()->AddAt(weight*sin2/rms[1],idtemp);
         }
         trackcounter2++;
       }
       else {
-        mQx1 += (weight*cos(2*track->Phi())/rms[0]);
-        mQy1 += (weight*sin(2*track->Phi())/rms[1]);
+        mQx1 += (weight*cos2/rms[0]);
+        mQy1 += (weight*sin2/rms[1]);
         if (fSaveTrackContribution){
-          EP->GetQContributionXArraysub1()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-          EP->GetQContributionYArraysub1()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
+          EP->GetQContributionXArraysub1()->AddAt(weight*cos2/rms[0],idtemp);
+          EP->GetQContributionYArraysub1()->AddAt(weight*sin2/rms[1],idtemp);
         }
         trackcounter1++;
       }
@@ -560,24 +585,26 @@ void AliEPSelectionTask::GetQsub(TVector2 &Q1, TVector2 &Q2, TObjArray* tracklis
       weight = 1;
       track = dynamic_cast<AliVTrack*> (tracklist->At(i));
       if (!track) continue;
-      weight = GetWeight(track);
+      weight = cached ? fTrackWeight[i] : GetWeight(track);
+      const Double_t cos2 = cached ? fTrackCos2[i] : cos(2*track->Phi());
+      const Double_t sin2 = cached ? fTrackSin2[i] : sin(2*track->Phi());
       Double_t eta = track->Eta();
       idtemp = track->GetID();
       if ((fAnalysisInput.CompareTo("AOD")==0) && (fAODfilterbit == 128)) idtemp = idtemp*(-1) - 1;
 
       if (eta > fEtaGap/2.) {
-        mQx1 += (weight*cos(2*track->Phi())/rms[0]);
-        mQy1 += (weight*sin(2*track->Phi())/rms[1]);
+        mQx1 += (weight*cos2/rms[0]);
+        mQy1 += (weight*sin2/rms[1]);
         if (fSaveTrackContribution){
-          EP->GetQContributionXArraysub1()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-          EP->GetQContributionYArraysub1()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
+          EP->GetQContributionXArraysub1()->AddAt(weight*cos2/rms[0],idtemp);
+          EP->GetQContributionYArraysub1()->AddAt(weight*sin2/rms[1],idtemp);
         }
       } else if (eta < -1.*fEtaGap/2.) {
-        mQx2 += (weight*cos(2*track->Phi())/rms[0]);
-        mQy2 += (weight*sin(2*track->Phi())/rms[1]);
+        mQx2 += (weight*cos2/rms[0]);
+        mQy2 += (weight*sin2/rms[1]);
         if (fSaveTrackContribution){
-          EP->GetQContributionXArraysub2()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-          EP->GetQContributionYArraysub2()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
+          EP->GetQContributionXArraysub2()->AddAt(weight*cos2/rms[0],idtemp);
+          EP->GetQContributionYArraysub2()->AddAt(weight*sin2/rms[1],idtemp);
         }
       }
     }
@@ -587,24 +614,26 @@ void AliEPSelectionTask::GetQsub(TVector2 &Q1, TVector2 &Q2, TObjArray* tracklis
       weight = 1;
       track = dynamic_cast<AliVTrack*> (tracklist->At(i));
       if (!track) continue;
-      weight = GetWeight(track);
+      weight = cached ? fTrackWeight[i] : GetWeight(track);
+      const Double_t cos2 = cached ? fTrackCos2[i] : cos(2*track->Phi());
+      const Double_t sin2 = cached ? fTrackSin2[i] : sin(2*track->Phi());
       Short_t cha = track->Charge();
       idtemp = track->GetID();
       if ((fAnalysisInput.CompareTo("AOD")==0) && (fAODfilterbit == 128)) idtemp = idtemp*(-1) - 1;
 
       if (cha > 0) {
-        mQx1 += (weight*cos(2*track->Phi())/rms[0]);
-        mQy1 += (weight*sin(2*track->Phi())/rms[1]);
+        mQx1 += (weight*cos2/rms[0]);
+        mQy1 += (weight*sin2/rms[1]);
         if (fSaveTrackContribution){
-          EP->GetQContributionXArraysub1()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-          EP->GetQContributionYArraysub1()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
+          EP->GetQContributionXArraysub1()->AddAt(weight*cos2/rms[0],idtemp);
+          EP->GetQContributionYArraysub1()->AddAt(weight*sin2/rms[1],idtemp);
         }
       } else if (cha < 0) {
-        mQx2 += (weight*cos(2*track->Phi())/rms[0]);
-        mQy2 += (weight*sin(2*track->Phi())/rms[1]);
+        mQx2 += (weight*cos2/rms[0]);
+        mQy2 += (weight*sin2/rms[1]);
         if (fSaveTrackContribution){
-          EP->GetQContributionXArraysub2()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-          EP->GetQContributionYArraysub2()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
+          EP->GetQContributionXArraysub2()->AddAt(weight*cos2/rms[0],idtemp);
+          EP->GetQContributionYArraysub2()->AddAt(weight*sin2/rms[1],idtemp);
         }
       }
     }
@@ -693,6 +722,18 @@ Double_t AliEPSelectionTask::GetPhiWeight(TObject* track1)
   Double_t phiweight=1;
   AliVTrack* track = dynamic_cast<AliVTrack*>(track1);
 
+  if (fUsePhiWeight && track) {
+    // weights of the run tabulated in BuildPhiWeights
+    Int_t idist = SelectPhiDistIndex(track);
+    if (idist >= 0 && fPhiWeights[idist].GetSize() > 0) {
+      Double_t nPhibins = fPhiWeights[idist].GetSize()-2;
+      Int_t bin = 1+TMath::FloorNint((track->Phi())*nPhibins/TMath::TwoPi());
+      if (bin < 0) bin = 0;
+      if (bin >= fPhiWeights[idist].GetSize()) bin = fPhiWeights[idist].GetSize()-1;
+      return fPhiWeights[idist][bin];
+    }
+  }
+
   TH1F *phiDist = 0x0;
   if(track) phiDist = SelectPhiDist(track);
 
@@ -814,6 +855,26 @@ void AliEPSelectionTask::SetPhiDist()
   AliInfo("No Phi-weights available. All Phi weights set to 1");
   SetUsePhiWeight(kFALSE);
   }
+  BuildPhiWeights();
+}
+
+//__________________________________________________________________________
+void AliEPSelectionTask::BuildPhiWeights()
+{
+  // Tabulate the phi weights of the run bin by bin, so that the weight of a
+  // track does not need the integral of the phi distribution
+  for (Int_t i = 0; i < 4; i++) {
+    fPhiWeights[i].Set(0);
+    TH1F* phiDist = fPhiDist[i];
+    if (!phiDist) continue;
+    Double_t nParticles = phiDist->Integral();
+    Double_t nPhibins = phiDist->GetNbinsX();
+    fPhiWeights[i].Set(phiDist->GetNbinsX()+2);
+    for (Int_t ib = 0; ib < fPhiWeights[i].GetSize(); ib++) {
+      Double_t PhiDistValue = phiDist->GetBinContent(ib);
+      fPhiWeights[i][ib] = (PhiDistValue > 0) ? nParticles/nPhibins/PhiDistValue : 1.;
+    }
+  }
 }
 
 //__________________________________________________________________________
@@ -965,22 +1026,145 @@ void AliEPSelectionTask::SetOADBandPeriod()
 //_________________________________________________________________________
 TH1F* AliEPSelectionTask::SelectPhiDist(AliVTrack *track)
 {
-  if (fPeriod.CompareTo("LHC10h")==0  || fUserphidist) return fPhiDist[0];
+  Int_t idist = SelectPhiDistIndex(track);
+  return idist < 0 ? 0 : fPhiDist[idist];
+}
+
+//_________________________________________________________________________
+Int_t AliEPSelectionTask::SelectPhiDistIndex(AliVTrack *track) const
+{
+  // Index of the phi distribution for the track, -1 if none
+  if (fPeriod.CompareTo("LHC10h")==0  || fUserphidist) return 0;
   else if(fPeriod.CompareTo("LHC11h")==0)
     {
      if (track->Charge() < 0)
        {
-        if(track->Eta() < 0.)       return fPhiDist[0];
-        else if (track->Eta() > 0.) return fPhiDist[2];
+        if(track->Eta() < 0.)       return 0;
+        else if (track->Eta() > 0.) return 2;
        }
       else if (track->Charge() > 0)
        {
-        if(track->Eta() < 0.)       return fPhiDist[1];
-        else if (track->Eta() > 0.) return fPhiDist[3];
+        if(track->Eta() < 0.)       return 1;
+        else if (track->Eta() > 0.) return 3;
        }
 
     }
-  return 0;
+  return -1;
+}
+
+//_________________________________________________________________________
+void AliEPSelectionTask::CacheTracks(TObjArray* tracklist)
+{
+  // Compute the weights and cos/sin(2 phi) of the tracks once per event,
+  // they are used by GetQ, GetQsub and FillQVectors
+  const Int_t nt = tracklist->GetEntries();
+  fTrackWeight.Set(nt);
+  fTrackCos2.Set(nt);
+  fTrackSin2.Set(nt);
+  for (Int_t i = 0; i < nt; i++) {
+    AliVTrack* track = dynamic_cast<AliVTrack*> (tracklist->At(i));
+    if (!track) {
+      fTrackWeight[i] = 1.;
+      fTrackCos2[i] = fTrackSin2[i] = 0.;
+      continue;
+    }
+    fTrackWeight[i] = GetWeight(track);
+    fTrackCos2[i] = cos(2*track->Phi());
+    fTrackSin2[i] = sin(2*track->Phi());
+  }
+  fCachedTrackList = tracklist;
+}
+
+//_________________________________________________________________________
+void AliEPSelectionTask::ClearTrackCache()
+{
+  // Invalidate the track cache, the track list of the event is deleted
+  fCachedTrackList = 0;
+}
+
+//_________________________________________________________________________
+void AliEPSelectionTask::FillQVectors(AliVEvent* event, TObjArray* tracklist)
+{
+  //
+  // Q-vectors for harmonics 1-6 from the TPC tracks, with the weights used
+  // for the event plane, and from the equalized VZERO multiplicities.
+  // They are attached to the input event, so that all the tasks of the
+  // train share them instead of recomputing their own.
+  //
+  AliEPQVectors* qvec = AliEPQVectors::FromEvent(event);
+  if (!qvec) {
+    qvec = new AliEPQVectors(AliEPQVectors::GetStdName());
+    event->AddObject(qvec);
+  }
+  qvec->Reset();
+
+  const Int_t nH = AliEPQVectors::kNHarmonics;
+  Double_t qx[nH], qy[nH];
+
+  // TPC: cos((n+1)phi) and sin((n+1)phi) by recursion from cos(phi), sin(phi)
+  for (Int_t ih = 0; ih < nH; ih++) qx[ih] = qy[ih] = 0.;
+  Double_t sumw = 0.;
+  Int_t mult = 0;
+  const Int_t nt = tracklist ? tracklist->GetEntries() : 0;
+  const Bool_t cached = (tracklist == fCachedTrackList);
+  for (Int_t i = 0; i < nt; i++) {
+    AliVTrack* track = dynamic_cast<AliVTrack*> (tracklist->At(i));
+    if (!track) continue;
+    const Double_t w = cached ? fTrackWeight[i] : GetWeight(track);
+    const Double_t c1 = TMath::Cos(track->Phi());
+    const Double_t s1 = TMath::Sin(track->Phi());
+    Double_t cn = c1, sn = s1;
+    for (Int_t ih = 0; ih < nH; ih++) {
+      qx[ih] += w*cn;
+      qy[ih] += w*sn;
+      const Double_t cnext = cn*c1 - sn*s1;
+      sn = sn*c1 + cn*s1;
+      cn = cnext;
+    }
+    sumw += w;
+    mult++;
+  }
+  // the OADB recentering is available for the second harmonic only
+  const Bool_t recenter = fUseRecentering && fQDist[0] && fQDist[1] && fCentrality!=-1.;
+  Double_t mean[2], rms[2];
+  Recenter(0, mean);
+  Recenter(1, rms);
+  for (Int_t ih = 0; ih < nH; ih++) {
+    if (ih == 1) qvec->SetQ(AliEPQVectors::kTPC, 2, (qx[1]-mean[0])/rms[0], (qy[1]-mean[1])/rms[1], recenter);
+    else qvec->SetQ(AliEPQVectors::kTPC, ih+1, qx[ih], qy[ih]);
+  }
+  qvec->SetSumOfWeights(AliEPQVectors::kTPC, sumw);
+  qvec->SetMultiplicity(AliEPQVectors::kTPC, mult);
+
+  // VZERO: 8 sectors per ring, channels 0-31 on side C and 32-63 on side A
+  Double_t sectorMult[2][8];
+  Int_t nChannels[2] = {0, 0};
+  for (Int_t side = 0; side < 2; side++)
+    for (Int_t isec = 0; isec < 8; isec++) sectorMult[side][isec] = 0.;
+  for (Int_t ich = 0; ich < 64; ich++) {
+    const Float_t m = event->GetVZEROEqMultiplicity(ich);
+    if (!(m > 0)) continue;
+    sectorMult[ich/32][ich%8] += m;
+    nChannels[ich/32]++;
+  }
+  for (Int_t side = 0; side < 2; side++) {
+    const Int_t det = (side == 0) ? AliEPQVectors::kV0C : AliEPQVectors::kV0A;
+    for (Int_t ih = 0; ih < nH; ih++) qx[ih] = qy[ih] = 0.;
+    sumw = 0.;
+    for (Int_t isec = 0; isec < 8; isec++) {
+      const Double_t m = sectorMult[side][isec];
+      if (!(m > 0)) continue;
+      const Double_t phi = TMath::PiOver4()*(isec+0.5);
+      for (Int_t ih = 0; ih < nH; ih++) {
+        qx[ih] += m*TMath::Cos((ih+1)*phi);
+        qy[ih] += m*TMath::Sin((ih+1)*phi);
+      }
+      sumw += m;
+    }
+    for (Int_t ih = 0; ih < nH; ih++) qvec->SetQ(det, ih+1, qx[ih], qy[ih]);
+    qvec->SetSumOfWeights(det, sumw);
+    qvec->SetMultiplicity(det, nChannels[side]);
+  }
 }
 
 TObjArray* AliEPSelectionTask::GetTracksForLHC11h(AliESDEvent* esd)
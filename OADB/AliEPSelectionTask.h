@@ -9,6 +9,7 @@
 //   author: Alberica Toia, Johanna Gramling
 //*****************************************************
 
+#include <TArrayD.h>
 #include "AliAnalysisTaskSE.h"
 
 class TFile;
@@ -22,6 +23,7 @@ class AliESDEvent;
 class AliESDtrackCuts;
 class AliESDtrack;
 class AliEventplane;
+class AliEPQVectors;
 class AliOADBContainer;
 class AliVTrack;
 class THnSparse;
@@ -63,6 +65,7 @@ class AliEPSelectionTask : public AliAnalysisTaskSE {
   void SetPersonalPhiDistribution(const char* filename, char* listname);
   void SetEtaGap(Float_t etagap)             {fEtaGap = etagap;}
   void SetSubeventsSplitMethod(Int_t method) {fSplitMethod = method;}
+  void SetComputeQVectors(Bool_t flag = kTRUE) {fComputeQVectors = flag;}
   
  private:
    
@@ -72,6 +75,11 @@ class AliEPSelectionTask : public AliAnalysisTaskSE {
   TObjArray* GetAODTracksAndMaxID(AliAODEvent* aod, Int_t& maxid);
   void SetOADBandPeriod();
   TH1F* SelectPhiDist(AliVTrack *track);
+  Int_t SelectPhiDistIndex(AliVTrack *track) const;
+  void BuildPhiWeights();
+  void CacheTracks(TObjArray* tracklist);
+  void ClearTrackCache();
+  void FillQVectors(AliVEvent* event, TObjArray* tracklist);
   TObjArray* GetTracksForLHC11h(AliESDEvent* esd);
 
   TString  fAnalysisInput; 		// "ESD", "AOD"
@@ -89,6 +97,7 @@ class AliEPSelectionTask : public AliAnalysisTaskSE {
   UInt_t   fAODfilterbit;               // AOD filter bit for AOD track selection  
   Float_t  fEtaGap;                     // Eta Gap between Subevent A and B
   Int_t    fSplitMethod;                // Splitting Method for subevents
+  Bool_t   fComputeQVectors;            // attach the Q-vectors for harmonics 1-6 to the input event
   
 
   AliESDtrackCuts* fESDtrackCuts;       // track cuts
@@ -100,6 +109,12 @@ class AliEPSelectionTask : public AliAnalysisTaskSE {
   THnSparse *fSparseDist;               //! THn for eta-charge phi-weighting
   TProfile* fQDist[2];			// array of TProfiles with mean+rms for recentering
   TH1F *fHruns;                         // information about runwise statistics of phi-weights
+  TArrayD fPhiWeights[4];               //! phi weights per bin of fPhiDist, including under- and overflow
+
+  const TObjArray* fCachedTrackList;    //! track list of the event the cache refers to
+  TArrayD fTrackWeight;                 //! weight of the tracks of the event
+  TArrayD fTrackCos2;                   //! cos(2 phi) of the tracks of the event
+  TArrayD fTrackSin2;                   //! sin(2 phi) of the tracks of the event
 
   TVector2* fQVector;			//! Q-Vector of the event  
   Double_t* fQContributionX;		//! array of the tracks' contributions to X component of Q-Vector - index = track ID
@@ -119,7 +134,7 @@ class AliEPSelectionTask : public AliAnalysisTaskSE {
   TH2F*	 fHOutDiff;			//! control histogram: Difference of MC RP and EP - only filled if fUseMCRP is true!
   TH2F*  fHOutleadPTPsi;		//! control histogram: emission angle of leading pT track vs EP angle
 
-  ClassDef(AliEPSelectionTask,4); 
+  ClassDef(AliEPSelectionTask,5); 
 };
 
 #endif
@@ -3,10 +3,12 @@
 #include <algorithm>
 #include <array>
 using std::array;
+#include <map>
 #include <memory>
 #include <vector>
 using std::vector;
 
+#include <TBufferFile.h>
 #include <TClonesArray.h>
 #include <TH1D.h>
 #include <TH1I.h>
@@ -29,6 +31,20 @@ using std::vector;
 ClassImp(AliEventCutsContainer);
 ClassImp(AliEventCuts);
 
+/// Selection result shared by the AliEventCuts instances with the same configuration
+struct AliEventCutsSharedResult {
+  const AliVEvent* fEvent;
+  long long fEntry;
+  unsigned long fFlag;
+  float fCentPercentiles[2];
+  AliVVertex* fPrimaryVertex;
+  double fDeltaVtz;
+  int fNtracklets;
+  AliEventCutsContainer fContainer;
+};
+
+/// Last result per configuration hash, in the process
+static std::map<unsigned int,AliEventCutsSharedResult> gEventCutsSharedResults;
 
 
 /// Standard constructor with null selection
@@ -80,6 +96,13 @@ AliEventCuts::AliEventCuts(bool saveplots) : TList(),
   fPrimaryVertex{nullptr},
   fNewEvent{true},
   fOverrideAutoTriggerMask{false},
+  fShareResults{false},
+  fLazyMode{false},
+  fSetupRun{-1},
+  fConfigHash{0u},
+  fInputHandler{nullptr},
+  fDeltaVtz{0.},
+  fNtracklets{0},
   fCutStats{nullptr},
   fVtz{nullptr},
   fDeltaTrackSPDvtz{nullptr},
@@ -104,26 +127,68 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
     AutomaticSetup(ev);
   }
 
+  /// Run level setup: input handler and configuration hash are looked up once per run
+  if (current_run != fSetupRun || !fInputHandler) {
+    fSetupRun = current_run;
+    AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+    fInputHandler = (AliInputEventHandler*)mgr->GetInputEventHandler();
+    fConfigHash = ComputeConfigurationHash();
+  }
+
   if (fSavePlots && !this->Last()) {
     AddQAplotsToList();
   }
 
-  /// Event selection flag, as soon as the event does not pass one cut this becomes false.
+  if (!fShareResults || !LoadSharedResult(ev)) {
+    ComputeEventFlag(ev);
+    if (fShareResults) StoreSharedResult(ev);
+  }
+
+  bool allcuts = fFlag & BIT(kAllCuts);
+  if (fCutStats) {
+    for (int iCut = kNoCuts; iCut <= kAllCuts; ++iCut) {
+      if (TESTBIT(fFlag,iCut))
+        fCutStats->Fill(iCut);
+    }
+  }
+
+  /// In lazy mode the multiplicities are not available for the events rejected before the correlation cuts
+  const bool multAvailable = !fLazyMode || fContainer.fMultESD >= 0;
+
+  /// Filling the monitoring histograms (first iteration always filled, second iteration only for selected events.
+  for (int befaft = 0; befaft < 2; ++befaft) {
+    if (fCentrality[befaft]) fCentrality[befaft]->Fill(fCentPercentiles[0]);
+    if (fEstimCorrelation[befaft]) fEstimCorrelation[befaft]->Fill(fCentPercentiles[1],fCentPercentiles[0]);
+    if (fMultCentCorrelation[befaft]) fMultCentCorrelation[befaft]->Fill(fCentPercentiles[0],fNtracklets);
+    if (fVtz[befaft]) fVtz[befaft]->Fill(fPrimaryVertex->GetZ());
+    if (fDeltaTrackSPDvtz[befaft]) fDeltaTrackSPDvtz[befaft]->Fill(fDeltaVtz);
+    if (multAvailable) {
+      if (fTOFvsFB32[befaft]) fTOFvsFB32[befaft]->Fill(fContainer.fMultTrkFB32,fContainer.fMultTrkFB32TOF);
+      if (fTPCvsAll[befaft])  fTPCvsAll[befaft]->Fill(fContainer.fMultTrkTPC,float(fContainer.fMultESD) - fESDvsTPConlyLinearCut[1] * fContainer.fMultTrkTPC);
+      if (fMultvsV0M[befaft]) fMultvsV0M[befaft]->Fill(GetCentrality(),fContainer.fMultTrkFB32Acc);
+      if (fTPCvsTrkl[befaft]) fTPCvsTrkl[befaft]->Fill(fNtracklets,fContainer.fMultTrkTPC);
+    }
+    if (!allcuts) return false; /// Do not fill the "after" histograms if the event does not pass the cuts.
+  }
+
+  return true;
+}
+
+void AliEventCuts::ComputeEventFlag(AliVEvent *ev) {
+  /// Event selection flag: each cut sets its bit if passed, the bits are combined without branching on the outcome
+  /// of the previous cuts. Only the correlation cuts are skipped in lazy mode.
   fFlag = BIT(kNoCuts);
 
   /// Rejection of the DAQ incomplete events
-  if (!fRejectDAQincomplete || !ev->IsIncompleteDAQ()) fFlag |= BIT(kDAQincomplete);
+  fFlag |= (unsigned long)(!fRejectDAQincomplete || !ev->IsIncompleteDAQ()) << kDAQincomplete;
 
   /// Magnetic field selection
-  float bField = ev->GetMagneticField();
-  if (fRequiredSolenoidPolarity == 0 || fRequiredSolenoidPolarity * bField > 0.) fFlag |= BIT(kBfield);
+  const float bField = ev->GetMagneticField();
+  fFlag |= (unsigned long)(fRequiredSolenoidPolarity == 0 || fRequiredSolenoidPolarity * bField > 0.) << kBfield;
 
   /// Trigger mask
-  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
-  AliInputEventHandler* handl = (AliInputEventHandler*)mgr->GetInputEventHandler();
-  auto selected_trigger = handl->IsEventSelected() & fTriggerMask;
-  if ((selected_trigger == fTriggerMask && fRequireExactTriggerMask) || (selected_trigger && !fRequireExactTriggerMask))
-    fFlag |= BIT(kTrigger);
+  const unsigned long selected_trigger = fInputHandler->IsEventSelected() & fTriggerMask;
+  fFlag |= (unsigned long)((selected_trigger == fTriggerMask && fRequireExactTriggerMask) || (selected_trigger && !fRequireExactTriggerMask)) << kTrigger;
 
   /// Vertex selection
   const AliVVertex* vtTrc = ev->GetPrimaryVertex();
@@ -132,33 +197,33 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
   double covTrc[6],covSPD[6];
   vtTrc->GetCovarianceMatrix(covTrc);
   vtSPD->GetCovarianceMatrix(covSPD);
-  double dz = vtTrc->GetZ() - vtSPD->GetZ();
-  double errTot = TMath::Sqrt(covTrc[5]+covSPD[5]);
-  double errTrc = TMath::Sqrt(covTrc[5]);
-  double nsigTot = TMath::Abs(dz) / errTot, nsigTrc = TMath::Abs(dz) / errTrc;
+  const double dz = vtTrc->GetZ() - vtSPD->GetZ();
+  const double errTot = TMath::Sqrt(covTrc[5]+covSPD[5]);
+  const double errTrc = TMath::Sqrt(covTrc[5]);
+  const double nsigTot = TMath::Abs(dz) / errTot, nsigTrc = TMath::Abs(dz) / errTrc;
+  fDeltaVtz = dz;
 
   /// Vertex position cut
-  if (vtx->GetZ() >= fMinVtz && vtx->GetZ() <= fMaxVtz) fFlag |= BIT(kVertexPosition);
+  const double vtz = vtx->GetZ();
+  fFlag |= (unsigned long)(vtz >= fMinVtz && vtz <= fMaxVtz) << kVertexPosition;
 
   /// Vertex quality cuts
-  if (((vtTrc->GetNContributors() >= 2 ||  !fRequireTrackVertex) && vtSPD->GetNContributors() >= 1) && // Check if SPD vertex is there and (if required) check if Track vertex is present.
+  fFlag |= (unsigned long)(((vtTrc->GetNContributors() >= 2 ||  !fRequireTrackVertex) && vtSPD->GetNContributors() >= 1) && // Check if SPD vertex is there and (if required) check if Track vertex is present.
       (TMath::Abs(dz) <= fMaxDeltaSpdTrackAbsolute && nsigTot <= fMaxDeltaSpdTrackNsigmaSPD && nsigTrc <= fMaxDeltaSpdTrackNsigmaTrack) && // discrepancy track-SPD vertex
-      (!vtSPD->IsFromVertexerZ() || TMath::Sqrt(covSPD[5]) <= fMaxResolutionSPDvertex)
-     ) // quality cut on vertexer SPD z
-    fFlag |= BIT(kVertexQuality);
+      (!vtSPD->IsFromVertexerZ() || TMath::Sqrt(covSPD[5]) <= fMaxResolutionSPDvertex) // quality cut on vertexer SPD z
+     ) << kVertexQuality;
   fPrimaryVertex = const_cast<AliVVertex*>(vtx);
 
   /// SPD pile-up rejection
-  if (!ev->IsPileupFromSPD(fSPDpileupMinContributors,fSPDpileupMinZdist,fSPDpileupNsigmaZdist,fSPDpileupNsigmaDiamXY,fSPDpileupNsigmaDiamZ) &&
+  fFlag |= (unsigned long)(!ev->IsPileupFromSPD(fSPDpileupMinContributors,fSPDpileupMinZdist,fSPDpileupNsigmaZdist,fSPDpileupNsigmaDiamXY,fSPDpileupNsigmaDiamZ) &&
       (!fTrackletBGcut || !fUtils.IsSPDClusterVsTrackletBG(ev)) &&
-      (!fPileUpCutMV || !fUtils.IsPileUpMV(ev)))
-    fFlag |= BIT(kPileUp);
+      (!fPileUpCutMV || !fUtils.IsPileUpMV(ev))) << kPileUp;
 
   /// Centrality cuts:
   /// * Check for min and max centrality
   /// * Cross check correlation between two centrality estimators
   AliVMultiplicity* mult = ev->GetMultiplicity();
-  const int ntrkl = mult->GetNumberOfTracklets();
+  fNtracklets = mult->GetNumberOfTracklets();
   if (fCentralityFramework) {
     if (fCentralityFramework == 2) {
       AliCentrality* cent = ev->GetCentrality();
@@ -172,54 +237,34 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
     const auto& x = fCentPercentiles[1];
     const double center = x * fEstimatorsCorrelationCoef[1] + fEstimatorsCorrelationCoef[0];
     const double sigma = fEstimatorsSigmaPars[0] + fEstimatorsSigmaPars[1] * x + fEstimatorsSigmaPars[2] * x * x + fEstimatorsSigmaPars[3] * x * x * x;
-    if ((!fUseEstimatorsCorrelationCut || fMC ||
+    fFlag |= (unsigned long)((!fUseEstimatorsCorrelationCut || fMC ||
           (fCentPercentiles[0] >= center - fDeltaEstimatorNsigma[0] * sigma && fCentPercentiles[0] <= center + fDeltaEstimatorNsigma[1] * sigma))
         && fCentPercentiles[0] >= fMinCentrality
-        && fCentPercentiles[0] <= fMaxCentrality) fFlag |= BIT(kMultiplicity);
+        && fCentPercentiles[0] <= fMaxCentrality) << kMultiplicity;
   } else fFlag |= BIT(kMultiplicity);
 
   if (fUseVariablesCorrelationCuts && !fMC) {
-    ComputeTrackMultiplicity(ev);
-    const double fb32 = fContainer.fMultTrkFB32;
-    const double fb32acc = fContainer.fMultTrkFB32Acc;
-    const double fb32tof = fContainer.fMultTrkFB32TOF;
-    const double fb128 = fContainer.fMultTrkTPC;
-    const double esd = fContainer.fMultESD;
-    const double mu32tof = PolN(fb32,fTOFvsFB32correlationPars,3);
-    const double sigma32tof = PolN(fb32,fTOFvsFB32sigmaPars, 5);
-    const bool multV0Mcut = (fMultiplicityV0McorrCut) ? fb32acc > fMultiplicityV0McorrCut->Eval(fCentPercentiles[0]) : true;
-    if ((fb32tof <= mu32tof + fTOFvsFB32nSigmaCut[0] * sigma32tof && fb32tof >= mu32tof - fTOFvsFB32nSigmaCut[1] * sigma32tof) &&
-        (esd < fESDvsTPConlyLinearCut[0] + fESDvsTPConlyLinearCut[1] * fb128) &&
-        multV0Mcut &&
-        (fb128 < fFB128vsTrklLinearCut[0] + fFB128vsTrklLinearCut[1] * ntrkl))
-      fFlag |= BIT(kCorrelations);
-  } else fFlag |= BIT(kCorrelations);
-
-  bool allcuts = (fFlag == (BIT(kAllCuts) - 1));
-  if (allcuts) fFlag |= BIT(kAllCuts);
-  if (fCutStats) {
-    for (int iCut = kNoCuts; iCut <= kAllCuts; ++iCut) {
-      if (TESTBIT(fFlag,iCut))
-        fCutStats->Fill(iCut);
+    if (fLazyMode && fFlag != (BIT(kCorrelations) - 1)) {
+      /// Rejected anyway: skip the loop on the tracks
+      fContainer = AliEventCutsContainer();
+    } else {
+      ComputeTrackMultiplicity(ev);
+      const double fb32 = fContainer.fMultTrkFB32;
+      const double fb32acc = fContainer.fMultTrkFB32Acc;
+      const double fb32tof = fContainer.fMultTrkFB32TOF;
+      const double fb128 = fContainer.fMultTrkTPC;
+      const double esd = fContainer.fMultESD;
+      const double mu32tof = PolN(fb32,fTOFvsFB32correlationPars,3);
+      const double sigma32tof = PolN(fb32,fTOFvsFB32sigmaPars, 5);
+      const bool multV0Mcut = (fMultiplicityV0McorrCut) ? fb32acc > fMultiplicityV0McorrCut->Eval(fCentPercentiles[0]) : true;
+      fFlag |= (unsigned long)((fb32tof <= mu32tof + fTOFvsFB32nSigmaCut[0] * sigma32tof && fb32tof >= mu32tof - fTOFvsFB32nSigmaCut[1] * sigma32tof) &&
+          (esd < fESDvsTPConlyLinearCut[0] + fESDvsTPConlyLinearCut[1] * fb128) &&
+          multV0Mcut &&
+          (fb128 < fFB128vsTrklLinearCut[0] + fFB128vsTrklLinearCut[1] * fNtracklets)) << kCorrelations;
     }
-  }
-
-
-  /// Filling the monitoring histograms (first iteration always filled, second iteration only for selected events.
-  for (int befaft = 0; befaft < 2; ++befaft) {
-    if (fCentrality[befaft]) fCentrality[befaft]->Fill(fCentPercentiles[0]);
-    if (fEstimCorrelation[befaft]) fEstimCorrelation[befaft]->Fill(fCentPercentiles[1],fCentPercentiles[0]);
-    if (fMultCentCorrelation[befaft]) fMultCentCorrelation[befaft]->Fill(fCentPercentiles[0],ntrkl);
-    if (fVtz[befaft]) fVtz[befaft]->Fill(vtx->GetZ());
-    if (fDeltaTrackSPDvtz[befaft]) fDeltaTrackSPDvtz[befaft]->Fill(dz);
-    if (fTOFvsFB32[befaft]) fTOFvsFB32[befaft]->Fill(fContainer.fMultTrkFB32,fContainer.fMultTrkFB32TOF);
-    if (fTPCvsAll[befaft])  fTPCvsAll[befaft]->Fill(fContainer.fMultTrkTPC,float(fContainer.fMultESD) - fESDvsTPConlyLinearCut[1] * fContainer.fMultTrkTPC);
-    if (fMultvsV0M[befaft]) fMultvsV0M[befaft]->Fill(GetCentrality(),fContainer.fMultTrkFB32Acc);
-    if (fTPCvsTrkl[befaft]) fTPCvsTrkl[befaft]->Fill(ntrkl,fContainer.fMultTrkTPC);
-    if (!allcuts) return false; /// Do not fill the "after" histograms if the event does not pass the cuts.
-  }
+  } else fFlag |= BIT(kCorrelations);
 
-  return true;
+  fFlag |= (unsigned long)(fFlag == (BIT(kAllCuts) - 1)) << kAllCuts;
 }
 
 void AliEventCuts::AddQAplotsToList(TList *qaList, bool addCorrelationPlots) {
@@ -389,6 +434,73 @@ void AliEventCuts::ComputeTrackMultiplicity(AliVEvent *ev) {
   fContainer = *tmp_cont;
 }
 
+unsigned int AliEventCuts::ComputeConfigurationHash() {
+  /// Hash of everything that enters the selection result, evaluated at the first event of each run
+  vector<double> pars = {
+    double(fMC), double(fRequireTrackVertex), fMinVtz, fMaxVtz, fMaxDeltaSpdTrackAbsolute, fMaxDeltaSpdTrackNsigmaSPD,
+    fMaxDeltaSpdTrackNsigmaTrack, fMaxResolutionSPDvertex, double(fRejectDAQincomplete), double(fRequiredSolenoidPolarity),
+    double(fSPDpileupMinContributors), fSPDpileupMinZdist, fSPDpileupNsigmaZdist, fSPDpileupNsigmaDiamXY, fSPDpileupNsigmaDiamZ,
+    double(fTrackletBGcut), double(fPileUpCutMV), double(fCentralityFramework), fMinCentrality, fMaxCentrality,
+    double(fMultSelectionEvCuts), double(fUseVariablesCorrelationCuts), double(fUseEstimatorsCorrelationCut),
+    double(fRequireExactTriggerMask), double(fTriggerMask), double(fLazyMode)
+  };
+  pars.insert(pars.end(), fEstimatorsCorrelationCoef, fEstimatorsCorrelationCoef + 2);
+  pars.insert(pars.end(), fEstimatorsSigmaPars, fEstimatorsSigmaPars + 4);
+  pars.insert(pars.end(), fDeltaEstimatorNsigma, fDeltaEstimatorNsigma + 2);
+  pars.insert(pars.end(), fTOFvsFB32correlationPars, fTOFvsFB32correlationPars + 4);
+  pars.insert(pars.end(), fTOFvsFB32sigmaPars, fTOFvsFB32sigmaPars + 6);
+  pars.insert(pars.end(), fTOFvsFB32nSigmaCut, fTOFvsFB32nSigmaCut + 2);
+  pars.insert(pars.end(), fESDvsTPConlyLinearCut, fESDvsTPConlyLinearCut + 2);
+  pars.insert(pars.end(), fFB128vsTrklLinearCut, fFB128vsTrklLinearCut + 2);
+  if (fMultiplicityV0McorrCut) {
+    pars.insert(pars.end(), fMultiplicityV0McorrCut->GetParameters(), fMultiplicityV0McorrCut->GetParameters() + fMultiplicityV0McorrCut->GetNpar());
+  }
+
+  TString config = TString::Format("%s;%s;", fCentEstimators[0].data(), fCentEstimators[1].data());
+  if (fMultiplicityV0McorrCut) config += fMultiplicityV0McorrCut->GetExpFormula();
+  for (auto par : pars) config += TString::Format(";%.17g", par);
+
+  /// The analysis utils do not expose their settings: their streamed content is used instead
+  TBufferFile buf(TBuffer::kWrite);
+  fUtils.Streamer(buf);
+  return config.Hash() ^ TString::Hash(buf.Buffer(), buf.Length());
+}
+
+bool AliEventCuts::LoadSharedResult(AliVEvent *ev) {
+  /// Copy the result of an instance with the same configuration, if it already evaluated this event
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  if (!mgr) return false;
+  auto it = gEventCutsSharedResults.find(fConfigHash);
+  if (it == gEventCutsSharedResults.end()) return false;
+  const AliEventCutsSharedResult &res = it->second;
+  if (res.fEvent != ev || res.fEntry != mgr->GetCurrentEntry()) return false;
+
+  fFlag = res.fFlag;
+  fCentPercentiles[0] = res.fCentPercentiles[0];
+  fCentPercentiles[1] = res.fCentPercentiles[1];
+  fPrimaryVertex = res.fPrimaryVertex;
+  fDeltaVtz = res.fDeltaVtz;
+  fNtracklets = res.fNtracklets;
+  fContainer = res.fContainer;
+  return true;
+}
+
+void AliEventCuts::StoreSharedResult(AliVEvent *ev) {
+  /// Make the result of this event available to the instances with the same configuration
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  if (!mgr) return;
+  AliEventCutsSharedResult &res = gEventCutsSharedResults[fConfigHash];
+  res.fEvent = ev;
+  res.fEntry = mgr->GetCurrentEntry();
+  res.fFlag = fFlag;
+  res.fCentPercentiles[0] = fCentPercentiles[0];
+  res.fCentPercentiles[1] = fCentPercentiles[1];
+  res.fPrimaryVertex = fPrimaryVertex;
+  res.fDeltaVtz = fDeltaVtz;
+  res.fNtracklets = fNtracklets;
+  res.fContainer = fContainer;
+}
+
 void AliEventCuts::SetupRun2pp() {
   ::Info("AliEventCuts::SetupRun2pp","Setup event cuts for the Run2 pp periods.");
   SetName("StandardRun2ppEventCuts");
@@ -12,6 +12,7 @@ using std::string;
 #include "AliAnalysisUtils.h"
 
 class TList;
+class AliInputEventHandler;
 class TH1D;
 class TH1I;
 class TH2D;
@@ -59,6 +60,13 @@ class AliEventCuts : public TList {
     void   AddQAplotsToList(TList *qaList = 0x0, bool addCorrelationPlots = false);
     void   OverrideAutomaticTriggerSelection(unsigned long tr, bool ov = true) { fTriggerMask = tr; fOverrideAutoTriggerMask = ov; }
     void   SetManualMode (bool man = true) { fManualMode = man; }
+    /// Share the result of the selection among the AliEventCuts instances with the same configuration: the first one
+    /// evaluating an event stores flag, centrality, vertex and multiplicities, the others copy them (QA plots are still
+    /// filled by each instance). The configuration is fixed at the first event of each run.
+    void   SetShareResults (bool share = true) { fShareResults = share; }
+    /// In lazy mode the track multiplicities used by the correlation cuts are computed only for the events passing
+    /// all the other cuts; for the rejected events the correlation bit is not set and the correlation plots are not filled.
+    void   SetLazyMode (bool lazy = true) { fLazyMode = lazy; }
     void   SetupLHC11h();
     void   SetupLHC15o();
     void   SetupRun2pp();
@@ -125,6 +133,10 @@ class AliEventCuts : public TList {
   private:
     void          AutomaticSetup (AliVEvent *ev);
     void          ComputeTrackMultiplicity(AliVEvent *ev);
+    void          ComputeEventFlag(AliVEvent *ev);
+    unsigned int  ComputeConfigurationHash();
+    bool          LoadSharedResult(AliVEvent *ev);
+    void          StoreSharedResult(AliVEvent *ev);
     template<typename F> F PolN(F x, F* coef, int n);
 
     bool          fManualMode;                    ///< if true the cuts are not loaded automatically looking at the run number
@@ -141,6 +153,17 @@ class AliEventCuts : public TList {
     /// Overrides
     bool          fOverrideAutoTriggerMask;       ///<  If true the trigger mask chosen by the user is not overridden by the Automatic Setup
 
+    bool          fShareResults;                  ///<  If true the selection result is shared with the instances with the same configuration
+    bool          fLazyMode;                      ///<  If true the correlation cuts are evaluated only if all the other cuts passed
+
+    /// Run level quantities, set at the first event of each run
+    int                   fSetupRun;              //!<! Run of the current run level setup
+    unsigned int          fConfigHash;            //!<! Hash of the cut configuration
+    AliInputEventHandler *fInputHandler;          //!<! Input handler providing the physics selection
+
+    double        fDeltaVtz;                      //!<! Difference between the track and the SPD vertex z
+    int           fNtracklets;                    //!<! Number of SPD tracklets
+
     /// The following pointers are used to avoid the intense usage of FindObject. The objects pointed are owned by (TList*)this.
     TH1I* fCutStats;               //!<! Cuts statistics
     TH1D* fVtz[2];                 //!<! Vertex z distribution
@@ -154,7 +177,7 @@ class AliEventCuts : public TList {
     TH2F* fMultvsV0M[2];           //!<!
     TH2F* fTPCvsTrkl[2];           //!<!
 
-    ClassDef(AliEventCuts,1)
+    ClassDef(AliEventCuts,2)
 };
 
 template<typename F> F AliEventCuts::PolN(F x,F* coef, int n) {
@@ -67,6 +67,10 @@
 //-------------------------------------------------------------------------
 
 #include <Riostream.h>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
 #include <TH1F.h>
 #include <TH2F.h>
 #include <TList.h>
@@ -109,6 +113,209 @@
 #include "AliITSTriggerConditions.h"
 ClassImp(AliPhysicsSelection)
 
+//______________________________________________________________________________
+// Trigger classes and trigger logic of the current run in compiled form.
+// The trigger class strings are reduced to lists of indices in a table of the distinct
+// class names, for which the presence in the fired classes is checked once per event.
+// The trigger logic expressions are compiled to postfix code over trigger tokens, whose
+// decisions are evaluated at most once per event.
+class AliPhysicsSelectionProgram {
+public:
+  enum EOpCode { kPushToken, kPushConst, kNot, kNeg, kMul, kDiv, kAdd, kSub,
+                 kLess, kLessEq, kGreater, kGreaterEq, kEqual, kNotEqual, kAnd, kOr };
+  
+  struct TriggerClass {
+    std::vector<std::vector<Int_t> > fRequired; // groups of class names, one per group must be fired
+    std::vector<Int_t> fRejected;                // class names that must not be fired
+    std::vector<Int_t> fBunchCrossings;          // accepted bunch crossings, if any
+    UInt_t fReturnCode;                          // offline trigger bits returned if selected
+    Int_t fLogic;                                // trigger logic index
+    Int_t fOnline;                               // compiled online logic, -1 if not compiled
+    Int_t fOffline;                              // compiled offline logic, -1 if not compiled
+  };
+  
+  struct Expression {
+    std::vector<Int_t> fCode;                    // pairs of op code and argument
+    std::vector<Double_t> fConst;                // constants
+  };
+  
+  AliPhysicsSelectionProgram() : fNames(), fNameFired(), fClasses(), fExpressions(),
+    fTokenNames(), fTokenOffline(), fTokenTrigger(), fTokenValue(), fTokenStamp(), fStack(), fStamp(0) {}
+  
+  Int_t AddName(const TString& name) {
+    for (UInt_t i=0; i<fNames.size(); i++) if (fNames[i] == name) return i;
+    fNames.push_back(name);
+    fNameFired.push_back(0);
+    return fNames.size()-1;
+  }
+  
+  Int_t AddToken(const TString& name, Bool_t offline) {
+    for (UInt_t i=0; i<fTokenNames.size(); i++) if (fTokenNames[i] == name && fTokenOffline[i] == offline) return i;
+    fTokenNames.push_back(name);
+    fTokenOffline.push_back(offline);
+    fTokenTrigger.push_back(0);
+    fTokenValue.push_back(0);
+    fTokenStamp.push_back(-1);
+    return fTokenNames.size()-1;
+  }
+  
+  Int_t CompileExpression(const TString& logic, Bool_t offline);
+  
+  std::vector<TString> fNames;                   // distinct trigger class names
+  std::vector<Char_t> fNameFired;                // per event, name found in the fired classes
+  std::vector<TriggerClass> fClasses;            // collision then background trigger classes
+  std::vector<Expression> fExpressions;          // compiled trigger logic
+  std::vector<TString> fTokenNames;              // trigger tokens
+  std::vector<Bool_t> fTokenOffline;             // token used in offline logic
+  std::vector<Int_t> fTokenTrigger;              // AliTriggerAnalysis::Trigger of the token, including the offline flag
+  std::vector<Int_t> fTokenValue;                // per event, decision of the token
+  std::vector<Long64_t> fTokenStamp;             // event for which fTokenValue is valid
+  std::vector<Double_t> fStack;                  // evaluation stack
+  Long64_t fStamp;                               // current event
+  
+private:
+  // recursive descent parser, C operator precedence
+  Bool_t ParseOr     (Expression& e);
+  Bool_t ParseAnd    (Expression& e);
+  Bool_t ParseEqual  (Expression& e);
+  Bool_t ParseCompare(Expression& e);
+  Bool_t ParseAdd    (Expression& e);
+  Bool_t ParseMul    (Expression& e);
+  Bool_t ParseUnary  (Expression& e);
+  Bool_t ParsePrimary(Expression& e);
+  void   SkipSpaces() { while (fPos < fSource.Length() && isspace(fSource[fPos])) fPos++; }
+  Bool_t Accept(const char* op);
+  void   Emit(Expression& e, Int_t op, Int_t arg = 0) { e.fCode.push_back(op); e.fCode.push_back(arg); }
+  
+  TString fSource;                               // expression being compiled
+  Int_t fPos;                                    // parser position
+  Bool_t fParseOffline;                          // expression being compiled is offline logic
+};
+
+Bool_t AliPhysicsSelectionProgram::Accept(const char* op) {
+  SkipSpaces();
+  Int_t len = strlen(op);
+  if (fSource.Length() - fPos < len || strncmp(fSource.Data() + fPos, op, len)) return kFALSE;
+  // do not take the first character of a two-character operator
+  if (len == 1 && fPos + 1 < fSource.Length()) {
+    Char_t next = fSource[fPos+1];
+    if ((op[0] == '!' || op[0] == '<' || op[0] == '>') && next == '=') return kFALSE;
+    if ((op[0] == '&' || op[0] == '|') && next == op[0]) return kFALSE;
+  }
+  fPos += len;
+  return kTRUE;
+}
+
+Bool_t AliPhysicsSelectionProgram::ParseOr(Expression& e) {
+  if (!ParseAnd(e)) return kFALSE;
+  while (Accept("||")) { if (!ParseAnd(e)) return kFALSE; Emit(e, kOr); }
+  return kTRUE;
+}
+
+Bool_t AliPhysicsSelectionProgram::ParseAnd(Expression& e) {
+  if (!ParseEqual(e)) return kFALSE;
+  while (Accept("&&")) { if (!ParseEqual(e)) return kFALSE; Emit(e, kAnd); }
+  return kTRUE;
+}
+
+Bool_t AliPhysicsSelectionProgram::ParseEqual(Expression& e) {
+  if (!ParseCompare(e)) return kFALSE;
+  while (1) {
+    Int_t op = -1;
+    if      (Accept("==")) op = kEqual;
+    else if (Accept("!=")) op = kNotEqual;
+    else break;
+    if (!ParseCompare(e)) return kFALSE;
+    Emit(e, op);
+  }
+  return kTRUE;
+}
+
+Bool_t AliPhysicsSelectionProgram::ParseCompare(Expression& e) {
+  if (!ParseAdd(e)) return kFALSE;
+  while (1) {
+    Int_t op = -1;
+    if      (Accept("<=")) op = kLessEq;
+    else if (Accept(">=")) op = kGreaterEq;
+    else if (Accept("<"))  op = kLess;
+    else if (Accept(">"))  op = kGreater;
+    else break;
+    if (!ParseAdd(e)) return kFALSE;
+    Emit(e, op);
+  }
+  return kTRUE;
+}
+
+Bool_t AliPhysicsSelectionProgram::ParseAdd(Expression& e) {
+  if (!ParseMul(e)) return kFALSE;
+  while (1) {
+    Int_t op = -1;
+    if      (Accept("+")) op = kAdd;
+    else if (Accept("-")) op = kSub;
+    else break;
+    if (!ParseMul(e)) return kFALSE;
+    Emit(e, op);
+  }
+  return kTRUE;
+}
+
+Bool_t AliPhysicsSelectionProgram::ParseMul(Expression& e) {
+  if (!ParseUnary(e)) return kFALSE;
+  while (1) {
+    Int_t op = -1;
+    if      (Accept("*")) op = kMul;
+    else if (Accept("/")) op = kDiv;
+    else break;
+    if (!ParseUnary(e)) return kFALSE;
+    Emit(e, op);
+  }
+  return kTRUE;
+}
+
+Bool_t AliPhysicsSelectionProgram::ParseUnary(Expression& e) {
+  if (Accept("!")) { if (!ParseUnary(e)) return kFALSE; Emit(e, kNot); return kTRUE; }
+  if (Accept("-")) { if (!ParseUnary(e)) return kFALSE; Emit(e, kNeg); return kTRUE; }
+  return ParsePrimary(e);
+}
+
+Bool_t AliPhysicsSelectionProgram::ParsePrimary(Expression& e) {
+  SkipSpaces();
+  if (fPos >= fSource.Length()) return kFALSE;
+  if (Accept("(")) return ParseOr(e) && Accept(")");
+  const char* start = fSource.Data() + fPos;
+  if (isalpha(*start)) {
+    Int_t len = 1;
+    while (isalnum(start[len]) || start[len] == '_') len++;
+    Emit(e, kPushToken, AddToken(TString(start, len), fParseOffline));
+    fPos += len;
+    return kTRUE;
+  }
+  if (isdigit(*start) || *start == '.') {
+    char* end = 0;
+    Double_t val = strtod(start, &end);
+    if (end == start) return kFALSE;
+    e.fConst.push_back(val);
+    Emit(e, kPushConst, e.fConst.size()-1);
+    fPos += end - start;
+    return kTRUE;
+  }
+  return kFALSE;
+}
+
+Int_t AliPhysicsSelectionProgram::CompileExpression(const TString& logic, Bool_t offline) {
+  // compiles a trigger logic expression, returns its index or -1 if the syntax is not supported
+  fSource = logic;
+  fPos = 0;
+  fParseOffline = offline;
+  Expression e;
+  if (!ParseOr(e)) return -1;
+  SkipSpaces();
+  if (fPos != fSource.Length()) return -1;
+  if (fStack.size() < e.fCode.size()/2) fStack.resize(e.fCode.size()/2);
+  fExpressions.push_back(e);
+  return fExpressions.size()-1;
+}
+
 AliPhysicsSelection::AliPhysicsSelection() :
 AliAnalysisCuts("AliPhysicsSelection", "AliPhysicsSelection"),
 fPassName(""),
@@ -128,7 +335,9 @@ fPSOADB(0),
 fFillOADB(0),
 fTriggerOADB(0),
 fRegexp(new TPRegexp("([[:alpha:]]\\w*)")),
-fCashedTokens(NULL)
+fCashedTokens(NULL),
+fUseCompiledLogic(kTRUE),
+fProgram(0)
 {
   // constructor
   fCollTrigClasses.SetOwner(1);
@@ -158,7 +367,9 @@ fCashedTokens(NULL)
  fFillOADB(0),
  fTriggerOADB(0),
  fRegexp(new TPRegexp("([[:alpha:]]\\w*)")),
- fCashedTokens(NULL)
+ fCashedTokens(NULL),
+ fUseCompiledLogic(kTRUE),
+ fProgram(0)
  {
    // constructor
    fCollTrigClasses.SetOwner(1);
@@ -175,6 +386,7 @@ AliPhysicsSelection::~AliPhysicsSelection(){
   if (fTriggerOADB)  delete fTriggerOADB;
   delete fRegexp;
   delete fCashedTokens;
+  delete fProgram;
 }
 
 UInt_t AliPhysicsSelection::CheckTriggerClass(const AliVEvent* event, const char* trigger, Int_t& triggerLogic) const {
@@ -270,19 +482,7 @@ Bool_t AliPhysicsSelection::EvaluateTriggerLogic(const AliVEvent* event, AliTrig
     
     TString token(trigger(pos[0], pos[1]-pos[0]+1));
 
-    TParameter<Int_t>* param = dynamic_cast<TParameter<Int_t> *>(fCashedTokens->FindObject(token));
-    if (!param) {
-      TInterpreter::EErrorCode error;
-      Int_t bit = gInterpreter->ProcessLine(Form("AliTriggerAnalysis::k%s;", token.Data()), &error);
-      
-      if (error > 0) AliFatal(Form("Trigger token %s unknown", token.Data()));
-      
-      param = new TParameter<Int_t>(token, bit);
-      fCashedTokens->Add(param);
-      AliDebug(AliLog::kDebug, "Added token");
-    }
-    
-    Long64_t bit = param->GetVal();
+    Long64_t bit = GetTriggerToken(token);
     
     AliDebug(AliLog::kDebug, Form("Tok %d %d %s %lld", pos[0], pos[1], token.Data(), bit));
     
@@ -310,6 +510,123 @@ Bool_t AliPhysicsSelection::EvaluateTriggerLogic(const AliVEvent* event, AliTrig
   return result;
 }
 
+//______________________________________________________________________________
+Int_t AliPhysicsSelection::GetTriggerToken(const TString& token){
+  // returns the AliTriggerAnalysis::Trigger corresponding to a trigger token
+  TParameter<Int_t>* param = dynamic_cast<TParameter<Int_t> *>(fCashedTokens->FindObject(token));
+  if (!param) {
+    TInterpreter::EErrorCode error;
+    Int_t bit = gInterpreter->ProcessLine(Form("AliTriggerAnalysis::k%s;", token.Data()), &error);
+    
+    if (error > 0) AliFatal(Form("Trigger token %s unknown", token.Data()));
+    
+    param = new TParameter<Int_t>(token, bit);
+    fCashedTokens->Add(param);
+    AliDebug(AliLog::kDebug, "Added token");
+  }
+  return param->GetVal();
+}
+
+//______________________________________________________________________________
+void AliPhysicsSelection::CompileTriggerLogic(){
+  // compiles the trigger classes and the trigger logic of the current run,
+  // same syntax as in CheckTriggerClass and EvaluateTriggerLogic
+  delete fProgram;
+  fProgram = new AliPhysicsSelectionProgram;
+  
+  Int_t nColl = fCollTrigClasses.GetEntries();
+  Int_t nBG   = fBGTrigClasses.GetEntries();
+  std::vector<Int_t> onlineLogic, offlineLogic;
+  for (Int_t i=0; i<nColl+nBG; i++) {
+    const char* trigger = i<nColl ? fCollTrigClasses.At(i)->GetName() : fBGTrigClasses.At(i-nColl)->GetName();
+    AliPhysicsSelectionProgram::TriggerClass tc;
+    tc.fReturnCode = AliVEvent::kUserDefined;
+    tc.fLogic = 0;
+    
+    TString str(trigger);
+    TObjArray* tokens = str.Tokenize(" ");
+    for (Int_t j=0; j < tokens->GetEntries(); j++) {
+      TString str2(((TObjString*) tokens->At(j))->String());
+      if (str2[0] == '+' || str2[0] == '-') {
+        Bool_t flag = (str2[0] == '+');
+        str2.Remove(0, 1);
+        TObjArray* tokens2 = str2.Tokenize(",");
+        std::vector<Int_t> group;
+        for (Int_t k=0; k < tokens2->GetEntries(); k++) {
+          Int_t name = fProgram->AddName(((TObjString*) tokens2->At(k))->String());
+          if (flag) group.push_back(name);
+          else tc.fRejected.push_back(name);
+        }
+        delete tokens2;
+        if (flag) tc.fRequired.push_back(group);
+      }
+      else if (str2[0] == '#') { str2.Remove(0, 1); tc.fBunchCrossings.push_back(str2.Atoi()); }
+      else if (str2[0] == '&') { str2.Remove(0, 1); tc.fReturnCode = str2.Atoll(); }
+      else if (str2[0] == '*') { str2.Remove(0, 1); tc.fLogic = str2.Atoi(); }
+      else AliFatal(Form("Invalid trigger syntax: %s", trigger));
+    }
+    delete tokens;
+    
+    // each trigger logic is compiled once, unsupported syntax falls back to EvaluateTriggerLogic
+    if (tc.fLogic >= (Int_t) onlineLogic.size()) {
+      onlineLogic.resize(tc.fLogic+1, -2);
+      offlineLogic.resize(tc.fLogic+1, -2);
+    }
+    if (onlineLogic[tc.fLogic] == -2) {
+      onlineLogic[tc.fLogic]  = fProgram->CompileExpression(fPSOADB->GetHardwareTrigger(tc.fLogic), kFALSE);
+      offlineLogic[tc.fLogic] = fProgram->CompileExpression(fPSOADB->GetOfflineTrigger(tc.fLogic), kTRUE);
+      if (onlineLogic[tc.fLogic] < 0 || offlineLogic[tc.fLogic] < 0)
+        AliWarning(Form("Trigger logic %d not compiled, using the formula evaluation", tc.fLogic));
+    }
+    tc.fOnline  = onlineLogic[tc.fLogic];
+    tc.fOffline = offlineLogic[tc.fLogic];
+    fProgram->fClasses.push_back(tc);
+  }
+  
+  for (UInt_t i=0; i<fProgram->fTokenNames.size(); i++) {
+    Int_t bit = GetTriggerToken(fProgram->fTokenNames[i]);
+    if (fProgram->fTokenOffline[i]) bit |= AliTriggerAnalysis::kOfflineFlag;
+    fProgram->fTokenTrigger[i] = bit;
+  }
+}
+
+//______________________________________________________________________________
+Bool_t AliPhysicsSelection::EvaluateCompiledLogic(const AliVEvent* event, AliTriggerAnalysis* triggerAnalysis, Int_t expression){
+  // evaluates a compiled trigger logic, the trigger decisions are taken from the
+  // per-event cache or evaluated once with the given trigger analysis
+  const AliPhysicsSelectionProgram::Expression& e = fProgram->fExpressions[expression];
+  Double_t* stack = &fProgram->fStack[0];
+  Int_t n = 0;
+  for (UInt_t i=0; i<e.fCode.size(); i+=2) {
+    Int_t arg = e.fCode[i+1];
+    switch (e.fCode[i]) {
+      case AliPhysicsSelectionProgram::kPushToken:
+        if (fProgram->fTokenStamp[arg] != fProgram->fStamp) {
+          fProgram->fTokenValue[arg] = triggerAnalysis->EvaluateTrigger(event, (AliTriggerAnalysis::Trigger) fProgram->fTokenTrigger[arg]);
+          fProgram->fTokenStamp[arg] = fProgram->fStamp;
+        }
+        stack[n++] = fProgram->fTokenValue[arg];
+        break;
+      case AliPhysicsSelectionProgram::kPushConst: stack[n++] = e.fConst[arg];                          break;
+      case AliPhysicsSelectionProgram::kNot:       stack[n-1] = !stack[n-1];                            break;
+      case AliPhysicsSelectionProgram::kNeg:       stack[n-1] = -stack[n-1];                            break;
+      case AliPhysicsSelectionProgram::kMul:       n--; stack[n-1] = stack[n-1] *  stack[n];            break;
+      case AliPhysicsSelectionProgram::kDiv:       n--; stack[n-1] = stack[n] ? stack[n-1] / stack[n] : 0; break;
+      case AliPhysicsSelectionProgram::kAdd:       n--; stack[n-1] = stack[n-1] +  stack[n];            break;
+      case AliPhysicsSelectionProgram::kSub:       n--; stack[n-1] = stack[n-1] -  stack[n];            break;
+      case AliPhysicsSelectionProgram::kLess:      n--; stack[n-1] = stack[n-1] <  stack[n];            break;
+      case AliPhysicsSelectionProgram::kLessEq:    n--; stack[n-1] = stack[n-1] <= stack[n];            break;
+      case AliPhysicsSelectionProgram::kGreater:   n--; stack[n-1] = stack[n-1] >  stack[n];            break;
+      case AliPhysicsSelectionProgram::kGreaterEq: n--; stack[n-1] = stack[n-1] >= stack[n];            break;
+      case AliPhysicsSelectionProgram::kEqual:     n--; stack[n-1] = stack[n-1] == stack[n];            break;
+      case AliPhysicsSelectionProgram::kNotEqual:  n--; stack[n-1] = stack[n-1] != stack[n];            break;
+      case AliPhysicsSelectionProgram::kAnd:       n--; stack[n-1] = stack[n-1] && stack[n];            break;
+      case AliPhysicsSelectionProgram::kOr:        n--; stack[n-1] = stack[n-1] || stack[n];            break;
+    }
+  }
+  return n > 0 && stack[n-1];
+}
+
 //______________________________________________________________________________
 UInt_t AliPhysicsSelection::IsCollisionCandidate(const AliVEvent* event){
   // checks if the given event is a collision candidate
@@ -329,6 +646,47 @@ UInt_t AliPhysicsSelection::IsCollisionCandidate(const AliVEvent* event){
   UInt_t accept = 0;
   Int_t nColl = fCollTrigClasses.GetEntries();
   Int_t nBG   = fBGTrigClasses.GetEntries();
+  
+  if (fUseCompiledLogic && fProgram) {
+    // presence of each class name in the fired classes, then bit operations per trigger class
+    fProgram->fStamp++;
+    TString classes = event->GetFiredTriggerClasses();
+    for (UInt_t k=0; k<fProgram->fNames.size(); k++) fProgram->fNameFired[k] = classes.Contains(fProgram->fNames[k]);
+    Int_t bc = event->GetBunchCrossNumber();
+    
+    for (Int_t i=0; i<nColl+nBG; i++) {
+      const AliPhysicsSelectionProgram::TriggerClass& tc = fProgram->fClasses[i];
+      AliTriggerAnalysis* triggerAnalysis = static_cast<AliTriggerAnalysis*> (fTriggerAnalysis.At(i));
+      triggerAnalysis->FillTriggerClasses(event);
+      
+      Bool_t selected = kTRUE;
+      for (UInt_t k=0; k<tc.fRejected.size(); k++) selected &= !fProgram->fNameFired[tc.fRejected[k]];
+      for (UInt_t g=0; g<tc.fRequired.size(); g++) {
+        Bool_t found = kFALSE;
+        for (UInt_t k=0; k<tc.fRequired[g].size(); k++) found |= fProgram->fNameFired[tc.fRequired[g][k]];
+        selected &= found;
+      }
+      if (tc.fBunchCrossings.size()) {
+        Bool_t foundCorrectBC = kFALSE;
+        for (UInt_t k=0; k<tc.fBunchCrossings.size(); k++) foundCorrectBC |= (tc.fBunchCrossings[k] == bc);
+        selected &= foundCorrectBC;
+      }
+      if (!selected || !tc.fReturnCode) continue;
+      
+      Bool_t onlineDecision  = tc.fOnline  >= 0 ? EvaluateCompiledLogic(event, triggerAnalysis, tc.fOnline) :
+        EvaluateTriggerLogic(event, triggerAnalysis, fPSOADB->GetHardwareTrigger(tc.fLogic), kFALSE);
+      Bool_t offlineDecision = tc.fOffline >= 0 ? EvaluateCompiledLogic(event, triggerAnalysis, tc.fOffline) :
+        EvaluateTriggerLogic(event, triggerAnalysis, fPSOADB->GetOfflineTrigger(tc.fLogic), kTRUE);
+      triggerAnalysis->FillHistograms(event,onlineDecision,offlineDecision);
+      if (!onlineDecision) continue;
+      if (!offlineDecision) continue;
+      accept |= tc.fReturnCode;
+    }
+    
+    if (accept) AliDebug(AliLog::kDebug, Form("Accepted event as collision candidate with bit mask %d", accept));
+    return accept;
+  }
+  
   for (Int_t i=0; i<nColl+nBG; i++) {
     const char* triggerClass = i<nColl ? fCollTrigClasses.At(i)->GetName() : fBGTrigClasses.At(i-nColl)->GetName();
     AliDebug(AliLog::kDebug+1, Form("Processing trigger class %s", triggerClass));
@@ -516,6 +874,8 @@ Bool_t AliPhysicsSelection::Initialize(Int_t runNumber){
   }
   
   fCurrentRun = runNumber;
+  
+  if (fUseCompiledLogic) CompileTriggerLogic();
 
   TH1::AddDirectory(oldStatus);
   return kTRUE;
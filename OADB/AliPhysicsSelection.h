@@ -34,6 +34,7 @@ class AliOADBPhysicsSelection;
 class AliOADBFillingScheme;
 class AliOADBTriggerAnalysis;
 class TPRegexp;
+class AliPhysicsSelectionProgram;
 
 class AliPhysicsSelection : public AliAnalysisCuts{
 public:
@@ -84,11 +85,15 @@ public:
   void SetPassName(const TString passName) { fPassName = passName; }
   void DetectPassName();
   void ReadOCDB(Bool_t val) { fReadOCDB=val; }
+  void SetUseCompiledTriggerLogic(Bool_t flag = kTRUE) { fUseCompiledLogic = flag; }
   Bool_t IsMC() const { return fMC; }
 protected:
   UInt_t CheckTriggerClass(const AliVEvent* event, const char* trigger, Int_t& triggerLogic) const;
   Bool_t EvaluateTriggerLogic(const AliVEvent* event, AliTriggerAnalysis* triggerAnalysis, const char* triggerLogic, Bool_t offline);
   const char * GetTriggerString(TObjString * obj);
+  Int_t GetTriggerToken(const TString& token);
+  void CompileTriggerLogic();
+  Bool_t EvaluateCompiledLogic(const AliVEvent* event, AliTriggerAnalysis* triggerAnalysis, Int_t expression);
 
   TString fPassName;          // pass name for current run
   Int_t fCurrentRun;          // run number for which the object is initialized
@@ -110,8 +115,11 @@ protected:
 
   TPRegexp* fRegexp;        //! regular expression for trigger tokens
   TList* fCashedTokens;     //! trigger token lookup list
+  
+  Bool_t fUseCompiledLogic;                //  evaluate trigger classes and trigger logic from the form compiled at initialization
+  AliPhysicsSelectionProgram* fProgram;    //! trigger classes and trigger logic compiled for the current run
 
-  ClassDef(AliPhysicsSelection, 22)
+  ClassDef(AliPhysicsSelection, 23)
 private:
   AliPhysicsSelection(const AliPhysicsSelection&);
   AliPhysicsSelection& operator=(const AliPhysicsSelection&);
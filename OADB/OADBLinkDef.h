@@ -17,6 +17,7 @@
 #pragma link C++ class AliBackgroundSelection+;
 #pragma link C++ class AliCentralitySelectionTask+;
 #pragma link C++ class AliEPSelectionTask+;
+#pragma link C++ class AliEPQVectors+;
 #pragma link C++ class AliPhysicsSelection+;
 #pragma link C++ class AliPhysicsSelectionTask+;
 #pragma link C++ class AliTriggerAnalysis+;
@@ -24,6 +25,7 @@
 #pragma link C++ class AliCollisionNormalizationTask+;
 #pragma link C++ class AliEventCuts+;
 #pragma link C++ class AliEventCutsContainer+;
+#pragma link C++ class AliCalibObjectCache+;
 
 #pragma link C++ class AliMultVariable+;
 #pragma link C++ class AliMultInput+;
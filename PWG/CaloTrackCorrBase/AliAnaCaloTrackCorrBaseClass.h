@@ -80,6 +80,8 @@ public:
   virtual void           Print(const Option_t * ) const ;
   
   virtual void           Terminate(TList * /*outputList*/)      { ; }
+  
+  virtual void           FinishTaskOutput()                     { ; }
 
   // Histograms, cuts 
 	
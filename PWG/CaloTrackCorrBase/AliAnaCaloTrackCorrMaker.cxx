@@ -1149,5 +1149,18 @@ void AliAnaCaloTrackCorrMaker::Terminate(TList * outputList)
   } // Loop on analysis defined
 }
 
+//__________________________________________________________
+/// Execute FinishTaskOutput of the analysis, on the worker,
+/// before the output is sent for merging.
+//__________________________________________________________
+void AliAnaCaloTrackCorrMaker::FinishTaskOutput()
+{
+  for(Int_t iana = 0; iana <  fAnalysisContainer->GetEntries(); iana++)
+  {
+    AliAnaCaloTrackCorrBaseClass * ana =  ((AliAnaCaloTrackCorrBaseClass *) fAnalysisContainer->At(iana)) ;
+    ana->FinishTaskOutput();
+  } // Loop on analysis defined
+}
+
 
 
@@ -102,6 +102,8 @@ class AliAnaCaloTrackCorrMaker : public TObject {
   
   void    Terminate(TList * outputList);
   
+  void    FinishTaskOutput();
+  
  private:
   
   // General Data members
@@ -225,10 +225,13 @@ void AliAnalysisTaskCaloTrackCorrelation::Terminate(Option_t */*option*/)
 }
 
 //__________________________________________________________
-/// Put in the output some standard event summary histograms.
+/// Let the analysis finish their output on the worker and
+/// put in the output some standard event summary histograms.
 //__________________________________________________________
 void AliAnalysisTaskCaloTrackCorrelation::FinishTaskOutput()
 {
+  if ( fAna ) fAna->FinishTaskOutput();
+  
   if ( !fStoreEventSummary ) return ;
     
   AliAnalysisManager *am = AliAnalysisManager::GetAnalysisManager();
@@ -24,6 +24,10 @@
 #include "AliESDtrackCuts.h"
 #include "AliLog.h"
 
+//---- ROOT system ----
+#include <TBufferFile.h>
+#include <TObjString.h>
+
 /// \cond CLASSIMP
 ClassImp(AliCaloTrackESDReader) ;
 /// \endcond 
@@ -158,6 +162,49 @@ void  AliCaloTrackESDReader::SetTrackComplementaryCuts(AliESDtrackCuts * cuts)
   fESDtrackComplementaryCuts = cuts ;
 }
 
+//____________________________________________________________________________
+/// \return Hash of the streamed settings of a track cuts object, 0 if not set.
+/// The name and title are not included, so that identical cuts configured
+/// under different names give the same hash.
+//____________________________________________________________________________
+static UInt_t TrackCutsHash(AliESDtrackCuts * cuts)
+{
+  if ( !cuts ) return 0;
+  
+  TString name = cuts->GetName(), title = cuts->GetTitle();
+  cuts->SetNameTitle("","");
+  
+  TBufferFile buf(TBuffer::kWrite);
+  buf.WriteObjectAny(cuts,cuts->IsA());
+  UInt_t hash = TString::Hash(buf.Buffer(),buf.Length());
+  
+  cuts->SetNameTitle(name.Data(),title.Data());
+  
+  return hash;
+}
+
+//________________________________________________________
+/// Save parameters used for analysis in a string.
+/// The track cuts enter via the hash of their streamed settings, so that
+/// readers with different track selections get different input
+/// configuration hashes.
+//________________________________________________________
+TObjString *  AliCaloTrackESDReader::GetListOfParameters()
+{
+  // Recover the string from the mother class
+  TObjString * motherList = AliCaloTrackReader::GetListOfParameters();
+  TString parList = motherList->GetString();
+  delete motherList;
+  
+  // not a fixed size buffer, the cut names must not truncate the hashes
+  parList+=Form("ESD Track: Constrain %d, Cuts %s (%u), Complementary cuts %s (%u); ",
+                fConstrainTrack,
+                fESDtrackCuts ? fESDtrackCuts->GetName() : "none", TrackCutsHash(fESDtrackCuts),
+                fESDtrackComplementaryCuts ? fESDtrackComplementaryCuts->GetName() : "none", TrackCutsHash(fESDtrackComplementaryCuts)) ;
+  
+  return new TObjString(parList) ;
+}
+
 //_________________________________________________________________
 /// Connect the data pointers.
 //_________________________________________________________________
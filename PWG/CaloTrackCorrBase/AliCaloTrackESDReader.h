@@ -34,6 +34,8 @@ public:
   
   Bool_t           SelectTrack(AliVTrack* track, Double_t* pTrack);
   
+  TObjString *     GetListOfParameters() ;
+  
   AliESDtrackCuts* GetTrackCuts()                    const { return fESDtrackCuts     ; }
   void             SetTrackCuts(AliESDtrackCuts * cuts) ;
   
@@ -13,8 +13,12 @@
  * provided "as is" without express or implied warranty.                  *
  **************************************************************************/
 
+// --- C++ ---
+#include <map>
+
 // --- ROOT system ---
 #include <TFile.h>
+#include <TObjArray.h>
 #include <TGeoManager.h>
 #include <TStreamerInfo.h>
 
@@ -56,6 +60,51 @@
 ClassImp(AliCaloTrackReader) ;
 /// \endcond
 
+//________________________________________
+/// Selected input of one event, filled by the first
+/// reader with a given configuration hash and copied
+/// by the other readers with the same hash.
+/// Counts the readers using it, deleted with the last one.
+//________________________________________
+struct AliCaloTrackReaderSharedInput
+{
+  AliCaloTrackReaderSharedInput() : fNReaders(0), fEvent(0), fEventNumber(-1), fFilled(0),
+  fCTSTracks(), fEMCALClusters(), fDCALClusters(), fPHOSClusters(),
+  fTrackMult(0), fVertexBC(0), fNPileUpClusters(0), fNNonPileUpClusters(0)
+  {
+    for(Int_t i = 0; i < 19; i++)
+    {
+      fTrackBCEvent[i] = 0; fTrackBCEventCut[i] = 0;
+      fEMCalBCEvent[i] = 0; fEMCalBCEventCut[i] = 0;
+    }
+    
+    fV0ADC[0] = 0; fV0ADC[1] = 0;
+    fV0Mul[0] = 0; fV0Mul[1] = 0;
+  }
+  
+  Int_t            fNReaders;            ///< Number of readers with this configuration.
+  const AliVEvent* fEvent;               ///< Event of the stored input.
+  Int_t            fEventNumber;         ///< Event number of the stored input.
+  Int_t            fFilled;              ///< Bits of the filled steps, see sharedInputStep.
+  TObjArray        fCTSTracks;           ///< Selected tracks, not owner.
+  TObjArray        fEMCALClusters;       ///< Selected EMCal clusters, not owner.
+  TObjArray        fDCALClusters;        ///< Selected DCal clusters, not owner.
+  TObjArray        fPHOSClusters;        ///< Selected PHOS clusters, not owner.
+  Int_t            fTrackMult;           ///< Track multiplicity.
+  Int_t            fVertexBC;            ///< Vertex BC, after recalculation from tracks.
+  Int_t            fTrackBCEvent[19];    ///< Tracks per BC.
+  Int_t            fTrackBCEventCut[19]; ///< Tracks per BC after cuts.
+  Int_t            fNPileUpClusters;     ///< Clusters out of the time window.
+  Int_t            fNNonPileUpClusters;  ///< Clusters in the time window.
+  Int_t            fEMCalBCEvent[19];    ///< EMCal clusters per BC.
+  Int_t            fEMCalBCEventCut[19]; ///< EMCal clusters per BC after cuts.
+  Int_t            fV0ADC[2];            ///< Integrated V0 signal.
+  Int_t            fV0Mul[2];            ///< Integrated V0 multiplicity.
+};
+
+/// Shared input per configuration hash.
+static std::map<UInt_t,AliCaloTrackReaderSharedInput*> gCaloTrackReaderSharedInputs;
+
 //________________________________________
 /// Constructor. Initialize parameters.
 //________________________________________
@@ -126,6 +175,7 @@ fTimeStampEventFracMin(0),   fTimeStampEventFracMax(0),
 fTimeStampRunMin(0),         fTimeStampRunMax(0),
 fNPileUpClusters(-1),        fNNonPileUpClusters(-1),         fNPileUpClustersCut(3),
 fVertexBC(-200),             fRecalculateVertexBC(0),
+fShareInput(kFALSE),         fInputConfigHash(0),
 fUseAliCentrality(0),        fCentralityClass(""),            fCentralityOpt(0),
 fEventPlaneMethod(""),
 fFillInputNonStandardJetBranch(kFALSE),
@@ -149,6 +199,17 @@ fhNEventsAfterCut(0),        fNMCGenerToAccept(0),            fMCGenerEventHeade
 //_______________________________________
 AliCaloTrackReader::~AliCaloTrackReader()
 {
+  // Release the shared input of this configuration
+  if ( fInputConfigHash )
+  {
+    std::map<UInt_t,AliCaloTrackReaderSharedInput*>::iterator it = gCaloTrackReaderSharedInputs.find(fInputConfigHash);
+    if ( it != gCaloTrackReaderSharedInputs.end() && --(it->second->fNReaders) <= 0 )
+    {
+      delete it->second;
+      gCaloTrackReaderSharedInputs.erase(it);
+    }
+  }
+  
   DeletePointers();
 }
 
@@ -1049,6 +1110,245 @@ void AliCaloTrackReader::Init()
   // Activate debug level in AliAnaWeights
   if( fWeightUtils->GetDebug() >= 0 )
     (AliAnalysisManager::GetAnalysisManager())->AddClassDebug(fWeightUtils->ClassName(), fWeightUtils->GetDebug());
+  
+  // Register to the input shared by the readers with the same configuration
+  if ( fShareInput && !fInputConfigHash )
+  {
+    if ( fDataType == kMC )
+    {
+      AliInfo("Input sharing not available for MC reader, switch it off");
+      fShareInput = kFALSE;
+    }
+    else
+    {
+      fInputConfigHash = GetInputConfigurationHash();
+      
+      AliCaloTrackReaderSharedInput *& shared = gCaloTrackReaderSharedInputs[fInputConfigHash];
+      if ( !shared ) shared = new AliCaloTrackReaderSharedInput();
+      shared->fNReaders++;
+      
+      AliInfo(Form("Share input with readers of configuration hash %u, %d readers",fInputConfigHash,shared->fNReaders));
+    }
+  }
+}
+
+//_______________________________________
+/// Add the content of a fiducial cut array to the configuration string.
+//_______________________________________
+static void AddArrayToConfiguration(TString & conf, const TArrayF * array)
+{
+  if ( !array ) return;
+  
+  for(Int_t i = 0; i < array->GetSize(); i++)
+    conf += Form(" %.9g",array->At(i));
+  
+  conf += ";";
+}
+
+//_______________________________________
+/// \return Hash of the parameters used when filling the track,
+/// cluster and V0 input: the list of parameters of the reader and
+/// of its derived class, the cuts at full precision, the fiducial
+/// cut regions and the calorimeter correction switches.
+/// Readers with the same hash and the shared input switched on use
+/// the input filled by the first of them in the event. The correction
+/// parameters themselves (calibration, non linearity, bad channels)
+/// are not part of the hash, they should be configured alike.
+//_______________________________________
+UInt_t AliCaloTrackReader::GetInputConfigurationHash()
+{
+  TString conf = ClassName();
+  
+  TObjString * parList = GetListOfParameters();
+  conf += parList->GetString();
+  delete parList;
+  
+  conf += Form("CTS %d, pT (%.9g,%.9g), status %lu, SPD %d, mult eta %.9g, reject no track %d; ",
+               fFillCTS, fCTSPtMin, fCTSPtMax, fTrackStatus, fSelectSPDHitTracks, fTrackMultEtaCut, fDoRejectNoTrackEvents);
+  conf += Form("Track TOF %d, time cut %d (%.17g,%.17g), vertex BC recalculation %d; ",
+               fAccessTrackTOF, fUseTrackTimeCut, fTrackTimeCutMin, fTrackTimeCutMax, fRecalculateVertexBC);
+  conf += Form("Track DCA %d (%.17g,%.17g,%.17g); ",
+               fUseTrackDCACut, fTrackDCACut[0], fTrackDCACut[1], fTrackDCACut[2]);
+  
+  conf += Form("EMC %d, DCA %d, list <%s>, E (%.9g,%.9g), bad dist %.9g, ncells %d, recalculate %d, linearity %d, embedded %d; ",
+               fFillEMCAL, fFillDCAL, fEMCALClustersListName.Data(), fEMCALPtMin, fEMCALPtMax,
+               fEMCALBadChMinDist, fEMCALNCellsCut, fRecalculateClusters, fCorrectELinearity, fSelectEmbeddedClusters);
+  conf += Form("EMC time cut %d, param %d (%.17g,%.17g)",
+               fUseEMCALTimeCut, fUseParamTimeCut, fEMCALTimeCutMin, fEMCALTimeCutMax);
+  for(Int_t i = 0; i < 4; i++)
+    conf += Form(" %.9g %.17g", fEMCALParamTimeCutMin[i], fEMCALParamTimeCutMax[i]);
+  conf += Form("; EMC smearing %d, function %d, width %.9g, NLM [%d,%d]; ",
+               fSmearShowerShape, fSmearingFunction, fSmearShowerShapeWidth, fSmearNLMMin, fSmearNLMMax);
+  
+  conf += Form("PHOS %d, E (%.9g,%.9g), bad dist %.9g, ncells %d; ",
+               fFillPHOS, fPHOSPtMin, fPHOSPtMax, fPHOSBadChMinDist, fPHOSNCellsCut);
+  
+  conf += Form("Fiducial %d; ", fCheckFidCut);
+  if ( fCheckFidCut && fFiducialCut )
+  {
+    conf += Form("CTS %d, EMC %d, DCA %d, PHOS %d:", fFiducialCut->GetCTSFiducialCutStatus(), fFiducialCut->GetEMCALFiducialCut(),
+                 fFiducialCut->GetDCALFiducialCut(), fFiducialCut->GetPHOSFiducialCutStatus());
+    
+    AddArrayToConfiguration(conf, fFiducialCut->GetCTSFidCutMinEtaArray());
+    AddArrayToConfiguration(conf, fFiducialCut->GetCTSFidCutMaxEtaArray());
+    AddArrayToConfiguration(conf, fFiducialCut->GetCTSFidCutMinPhiArray());
+    AddArrayToConfiguration(conf, fFiducialCut->GetCTSFidCutMaxPhiArray());
+    AddArrayToConfiguration(conf, fFiducialCut->GetEMCALFidCutMinEtaArray());
+    AddArrayToConfiguration(conf, fFiducialCut->GetEMCALFidCutMaxEtaArray());
+    AddArrayToConfiguration(conf, fFiducialCut->GetEMCALFidCutMinPhiArray());
+    AddArrayToConfiguration(conf, fFiducialCut->GetEMCALFidCutMaxPhiArray());
+    AddArrayToConfiguration(conf, fFiducialCut->GetDCALFidCutMinEtaArray());
+    AddArrayToConfiguration(conf, fFiducialCut->GetDCALFidCutMaxEtaArray());
+    AddArrayToConfiguration(conf, fFiducialCut->GetDCALFidCutMinPhiArray());
+    AddArrayToConfiguration(conf, fFiducialCut->GetDCALFidCutMaxPhiArray());
+    AddArrayToConfiguration(conf, fFiducialCut->GetPHOSFidCutMinEtaArray());
+    AddArrayToConfiguration(conf, fFiducialCut->GetPHOSFidCutMaxEtaArray());
+    AddArrayToConfiguration(conf, fFiducialCut->GetPHOSFidCutMinPhiArray());
+    AddArrayToConfiguration(conf, fFiducialCut->GetPHOSFidCutMaxPhiArray());
+  }
+  
+  if ( fCaloUtils )
+  {
+    conf += Form("Utils: recalibration %d, linearity %d, position %d, matching %d, bad channels %d, masked columns %d",
+                 fCaloUtils->IsRecalibrationOn(), fCaloUtils->IsCorrectionOfClusterEnergyOn(),
+                 fCaloUtils->IsRecalculationOfClusterPositionOn(), fCaloUtils->IsRecalculationOfClusterTrackMatchingOn(),
+                 fCaloUtils->IsBadChannelsRemovalSwitchedOn(), fCaloUtils->GetNMaskCellColumns());
+    
+    if ( fCaloUtils->GetEMCALRecoUtils() )
+      conf += Form(", time recalibration %d, L1 phase %d, non linearity function %d",
+                   fCaloUtils->GetEMCALRecoUtils()->IsTimeRecalibrationOn(),
+                   fCaloUtils->GetEMCALRecoUtils()->IsL1PhaseInTimeRecalibrationOn(),
+                   fCaloUtils->GetEMCALRecoUtils()->GetNonLinearityFunction());
+  }
+  
+  UInt_t hash = conf.Hash();
+  if ( hash == 0 ) hash = 1; // 0 reserved for not registered readers
+  
+  AliDebug(1,Form("Input configuration hash %u: %s",hash,conf.Data()));
+  
+  return hash;
+}
+
+//_______________________________________
+/// Copy the result of a filling step from the input shared
+/// with the readers of the same configuration, if that step
+/// was already done by one of them in the current event.
+/// The control histograms of the step are not filled in this case.
+/// \param step: sharedInputStep
+/// \return kTRUE if the step was copied.
+//_______________________________________
+Bool_t AliCaloTrackReader::CopyFromSharedInput(Int_t step)
+{
+  if ( !fShareInput || !fInputConfigHash || fMixedEvent ) return kFALSE;
+  
+  std::map<UInt_t,AliCaloTrackReaderSharedInput*>::const_iterator it = gCaloTrackReaderSharedInputs.find(fInputConfigHash);
+  if ( it == gCaloTrackReaderSharedInputs.end() ) return kFALSE;
+  
+  const AliCaloTrackReaderSharedInput * shared = it->second;
+  if ( shared->fEvent != fInputEvent || shared->fEventNumber != fEventNumber || !(shared->fFilled & step) )
+    return kFALSE;
+  
+  if ( step == kSharedCTS )
+  {
+    fCTSTracks->AddAll(&shared->fCTSTracks);
+    fTrackMult = shared->fTrackMult;
+    fVertexBC  = shared->fVertexBC;
+    for(Int_t i = 0; i < 19; i++)
+    {
+      fTrackBCEvent   [i] = shared->fTrackBCEvent   [i];
+      fTrackBCEventCut[i] = shared->fTrackBCEventCut[i];
+    }
+  }
+  else if ( step == kSharedEMCAL )
+  {
+    fEMCALClusters->AddAll(&shared->fEMCALClusters);
+    fDCALClusters ->AddAll(&shared->fDCALClusters );
+    fNPileUpClusters    = shared->fNPileUpClusters;
+    fNNonPileUpClusters = shared->fNNonPileUpClusters;
+    for(Int_t i = 0; i < 19; i++)
+    {
+      fEMCalBCEvent   [i] = shared->fEMCalBCEvent   [i];
+      fEMCalBCEventCut[i] = shared->fEMCalBCEventCut[i];
+    }
+  }
+  else if ( step == kSharedPHOS )
+  {
+    fPHOSClusters->AddAll(&shared->fPHOSClusters);
+  }
+  else if ( step == kSharedVZERO )
+  {
+    fV0ADC[0] = shared->fV0ADC[0]; fV0ADC[1] = shared->fV0ADC[1];
+    fV0Mul[0] = shared->fV0Mul[0]; fV0Mul[1] = shared->fV0Mul[1];
+  }
+  
+  AliDebug(1,Form("Step %d copied from shared input",step));
+  
+  return kTRUE;
+}
+
+//_______________________________________
+/// Store the result of a filling step in the input shared
+/// with the readers of the same configuration.
+/// The stored input is reset when the event changes.
+/// \param step: sharedInputStep
+//_______________________________________
+void AliCaloTrackReader::CopyToSharedInput(Int_t step)
+{
+  if ( !fShareInput || !fInputConfigHash || fMixedEvent ) return;
+  
+  std::map<UInt_t,AliCaloTrackReaderSharedInput*>::iterator it = gCaloTrackReaderSharedInputs.find(fInputConfigHash);
+  if ( it == gCaloTrackReaderSharedInputs.end() ) return;
+  
+  AliCaloTrackReaderSharedInput * shared = it->second;
+  if ( shared->fEvent != fInputEvent || shared->fEventNumber != fEventNumber )
+  {
+    shared->fEvent       = fInputEvent;
+    shared->fEventNumber = fEventNumber;
+    shared->fFilled      = 0;
+    shared->fCTSTracks    .Clear();
+    shared->fEMCALClusters.Clear();
+    shared->fDCALClusters .Clear();
+    shared->fPHOSClusters .Clear();
+  }
+  
+  if ( step == kSharedCTS )
+  {
+    shared->fCTSTracks.Clear();
+    shared->fCTSTracks.AddAll(fCTSTracks);
+    shared->fTrackMult = fTrackMult;
+    shared->fVertexBC  = fVertexBC;
+    for(Int_t i = 0; i < 19; i++)
+    {
+      shared->fTrackBCEvent   [i] = fTrackBCEvent   [i];
+      shared->fTrackBCEventCut[i] = fTrackBCEventCut[i];
+    }
+  }
+  else if ( step == kSharedEMCAL )
+  {
+    shared->fEMCALClusters.Clear();
+    shared->fDCALClusters .Clear();
+    shared->fEMCALClusters.AddAll(fEMCALClusters);
+    shared->fDCALClusters .AddAll(fDCALClusters );
+    shared->fNPileUpClusters    = fNPileUpClusters;
+    shared->fNNonPileUpClusters = fNNonPileUpClusters;
+    for(Int_t i = 0; i < 19; i++)
+    {
+      shared->fEMCalBCEvent   [i] = fEMCalBCEvent   [i];
+      shared->fEMCalBCEventCut[i] = fEMCalBCEventCut[i];
+    }
+  }
+  else if ( step == kSharedPHOS )
+  {
+    shared->fPHOSClusters.Clear();
+    shared->fPHOSClusters.AddAll(fPHOSClusters);
+  }
+  else if ( step == kSharedVZERO )
+  {
+    shared->fV0ADC[0] = fV0ADC[0]; shared->fV0ADC[1] = fV0ADC[1];
+    shared->fV0Mul[0] = fV0Mul[0]; shared->fV0Mul[1] = fV0Mul[1];
+  }
+  
+  shared->fFilled |= step;
 }
 
 //_______________________________________
@@ -1463,7 +1763,12 @@ Bool_t AliCaloTrackReader::FillInputEvent(Int_t iEntry, const char * /*curFileNa
   
   if(fFillCTS)
   {
-    FillInputCTS();
+    if ( !CopyFromSharedInput(kSharedCTS) )
+    {
+      FillInputCTS();
+      CopyToSharedInput(kSharedCTS);
+    }
+    
     //Accept events with at least one track
     if(fTrackMult == 0 && fDoRejectNoTrackEvents) return kFALSE ;
     
@@ -1487,13 +1792,23 @@ Bool_t AliCaloTrackReader::FillInputEvent(Int_t iEntry, const char * /*curFileNa
   if(fFillPHOSCells)
     FillInputPHOSCells();
   
-  if(fFillEMCAL || fFillDCAL)
+  if( (fFillEMCAL || fFillDCAL) && !CopyFromSharedInput(kSharedEMCAL) )
+  {
     FillInputEMCAL();
+    CopyToSharedInput(kSharedEMCAL);
+  }
   
-  if(fFillPHOS)
+  if( fFillPHOS && !CopyFromSharedInput(kSharedPHOS) )
+  {
     FillInputPHOS();
+    CopyToSharedInput(kSharedPHOS);
+  }
   
-  FillInputVZERO();
+  if( !CopyFromSharedInput(kSharedVZERO) )
+  {
+    FillInputVZERO();
+    CopyToSharedInput(kSharedVZERO);
+  }
   
   //one specified jet branch
   if(fFillInputNonStandardJetBranch)
@@ -3013,6 +3328,7 @@ void AliCaloTrackReader::Print(const Option_t * opt) const
   printf("Track Mult Eta Cut =  %2.2f\n",  fTrackMultEtaCut) ;
   printf("Write delta AOD =     %d\n",     fWriteOutputDeltaAOD) ;
   printf("Recalculate Clusters = %d, E linearity = %d\n",    fRecalculateClusters, fCorrectELinearity) ;
+  printf("Share input with same configuration readers = %d, hash %u\n", fShareInput, fInputConfigHash) ;
   
   printf("Use Triggers selected in SE base class %d; If not what Trigger Mask? %d; MB Trigger Mask for mixed %d \n",
          fEventTriggerAtSE, fEventTriggerMask,fMixEventTriggerMask);
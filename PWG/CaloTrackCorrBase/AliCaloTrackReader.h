@@ -75,6 +75,14 @@ public:
   
   virtual void    ResetLists();
 
+  // Input lists shared among readers with the same configuration
+  
+  void            SwitchOnSharedInput()                    { fShareInput = kTRUE         ; }
+  void            SwitchOffSharedInput()                   { fShareInput = kFALSE        ; }
+  Bool_t          IsSharedInputOn()                  const { return fShareInput          ; }
+  
+  virtual UInt_t  GetInputConfigurationHash() ;
+
   virtual Int_t   GetDebug()                         const { return fDebug                 ; }
   virtual void    SetDebug(Int_t d)                        { fDebug = d                    ; }
   
@@ -911,6 +919,17 @@ public:
   Int_t            fVertexBC;                      ///<  Vertex BC.
   Bool_t           fRecalculateVertexBC;           ///<  Recalculate vertex BC from tracks pointing to vertex.
   
+  // Input shared among readers
+  
+  /// Input filling steps that can be shared among readers
+  enum sharedInputStep { kSharedCTS = 1, kSharedEMCAL = 2, kSharedPHOS = 4, kSharedVZERO = 8 } ;
+  
+  Bool_t           CopyFromSharedInput(Int_t step) ;
+  void             CopyToSharedInput  (Int_t step) ;
+  
+  Bool_t           fShareInput;                    ///<  Take the selected tracks, clusters and V0 signal from the first reader with the same configuration in the event.
+  UInt_t           fInputConfigHash;               //!<! Hash of the input configuration, set in Init() when the input is shared.
+  
   // Centrality/Event plane
   Bool_t           fUseAliCentrality;              ///<  Select as centrality estimator AliCentrality (Run1) or AliMultSelection (Run1 and Run2)
   TString          fCentralityClass;               ///<  Name of selected centrality class.     
@@ -960,7 +979,7 @@ public:
   AliCaloTrackReader & operator = (const AliCaloTrackReader & r) ; 
   
   /// \cond CLASSIMP
-  ClassDef(AliCaloTrackReader,76) ;
+  ClassDef(AliCaloTrackReader,77) ;
   /// \endcond
 
 } ;
@@ -54,7 +54,15 @@ fFracIsThresh(1),
 fIsTMClusterInConeRejected(1),
 fDistMinToTrigger(-1.),
 fMomentum(),
-fTrackVector()
+fTrackVector(),
+fUseConeIndex(kFALSE),
+fTrackIndex(),
+fClusterIndex(),
+fSelected(),
+fBadCellMapRun(-1),
+fBadCellMap(),
+fConeCellsDensity(),
+fConeCellsCoeff()
 {
   InitParameters();
 }
@@ -195,45 +203,50 @@ Float_t AliIsolationCut::GetCellDensity(AliAODPWG4ParticleCorrelation * pCandida
       Int_t rowC = iPhi + AliEMCALGeoParams::fgkEMCALRows*int(nSupMod/2);
 
       Int_t sqrSize = int(fConeSize/0.0143) ; // Size of cell in radians
-      //loop on cells in a square of side fConeSize to check cells in cone
-      for(Int_t icol = colC-sqrSize; icol < colC+sqrSize;icol++)
+
+      // Cells counting only depends on the candidate cell and the bad channel map of the run
+      CheckBadCellMapRun(reader);
+      Int_t cache = -1;
+      if ( colC >= 0 && colC < kConeNCols && rowC >= 0 && rowC < kConeNRows ) cache = 3*(colC*kConeNRows+rowC);
+
+      if ( cache >= 0 && fConeCellsDensity[cache] == sqrSize )
+      {
+        coneCells    = fConeCellsDensity[cache+1];
+        coneCellsBad = fConeCellsDensity[cache+2];
+      }
+      else
       {
-        for(Int_t irow = rowC-sqrSize; irow < rowC+sqrSize; irow++)
+        //loop on cells in a square of side fConeSize to check cells in cone
+        for(Int_t icol = colC-sqrSize; icol < colC+sqrSize;icol++)
         {
-          if (Radius(colC, rowC, icol, irow) < sqrSize)
+          for(Int_t irow = rowC-sqrSize; irow < rowC+sqrSize; irow++)
           {
-            coneCells += 1.;
-
-            Int_t cellSM  = -999;
-            Int_t cellEta = -999;
-            Int_t cellPhi = -999;
-            if(icol > AliEMCALGeoParams::fgkEMCALCols-1)
+            if (Radius(colC, rowC, icol, irow) < sqrSize)
             {
-              cellSM = 0+int(irow/AliEMCALGeoParams::fgkEMCALRows)*2;
-              cellEta = icol-AliEMCALGeoParams::fgkEMCALCols;
-              cellPhi = irow-AliEMCALGeoParams::fgkEMCALRows*int(cellSM/2);
-            }
-            if(icol < AliEMCALGeoParams::fgkEMCALCols)
-            {
-              cellSM = 1+int(irow/AliEMCALGeoParams::fgkEMCALRows)*2;
-              cellEta = icol;
-              cellPhi = irow-AliEMCALGeoParams::fgkEMCALRows*int(cellSM/2);
-            }
+              coneCells += 1.;
 
-            //Count as bad "cells" out of EMCAL acceptance
-            if(icol < 0 || icol > AliEMCALGeoParams::fgkEMCALCols*2 ||
-               irow < 0 || irow > AliEMCALGeoParams::fgkEMCALRows*16./3) //5*nRows+1/3*nRows
-            {
-              coneCellsBad += 1.;
-            }
-            //Count as bad "cells" marked as bad in the DataBase
-            else if (cu->GetEMCALChannelStatus(cellSM,cellEta,cellPhi)==1)
-            {
-              coneCellsBad += 1. ;
+              //Count as bad "cells" out of EMCAL acceptance
+              if(icol < 0 || icol > AliEMCALGeoParams::fgkEMCALCols*2 ||
+                 irow < 0 || irow > AliEMCALGeoParams::fgkEMCALRows*16./3) //5*nRows+1/3*nRows
+              {
+                coneCellsBad += 1.;
+              }
+              //Count as bad "cells" marked as bad in the DataBase
+              else if (IsBadCellInGrid(cu,icol,irow))
+              {
+                coneCellsBad += 1. ;
+              }
             }
           }
+        }//end of cells loop
+
+        if ( cache >= 0 )
+        {
+          fConeCellsDensity[cache  ] = sqrSize;
+          fConeCellsDensity[cache+1] = coneCells;
+          fConeCellsDensity[cache+2] = coneCellsBad;
         }
-      }//end of cells loop
+      }
     }
     else AliWarning("Cluster with bad (eta,phi) in EMCal for energy density calculation");
 
@@ -282,41 +295,62 @@ void AliIsolationCut::GetCoeffNormBadCell(AliAODPWG4ParticleCorrelation * pCandi
       Int_t rowC = iPhi + AliEMCALGeoParams::fgkEMCALRows*int(nSupMod/2);
 
       Int_t sqrSize = int(fConeSize/0.0143) ; // Size of cell in radians
-      for(Int_t icol = 0; icol < 2*AliEMCALGeoParams::fgkEMCALCols-1;icol++)
+
+      // Cells counting only depends on the candidate cell and the bad channel map of the run
+      CheckBadCellMapRun(reader);
+      Int_t cache = -1;
+      if ( colC >= 0 && colC < kConeNCols && rowC >= 0 && rowC < kConeNRows ) cache = 7*(colC*kConeNRows+rowC);
+
+      Float_t coneBadCells    = 0.;
+      Float_t phiBandBadCells = 0.;
+      Float_t etaBandBadCells = 0.;
+
+      if ( cache >= 0 && fConeCellsCoeff[cache] == sqrSize )
+      {
+        coneCells       = fConeCellsCoeff[cache+1];
+        coneBadCells    = fConeCellsCoeff[cache+2];
+        phiBandCells    = fConeCellsCoeff[cache+3];
+        phiBandBadCells = fConeCellsCoeff[cache+4];
+        etaBandCells    = fConeCellsCoeff[cache+5];
+        etaBandBadCells = fConeCellsCoeff[cache+6];
+      }
+      else
       {
-        for(Int_t irow = 0; irow < 5*AliEMCALGeoParams::fgkEMCALRows -1; irow++)
+        for(Int_t icol = 0; icol < 2*AliEMCALGeoParams::fgkEMCALCols-1;icol++)
         {
-          //loop on cells in a square of side fConeSize to check cells in cone
-          if     ( Radius(colC, rowC, icol, irow) < sqrSize ) { coneCells    += 1.; }
-          else if( icol>colC-sqrSize  &&  icol<colC+sqrSize ) { phiBandCells += 1 ; }
-          else if( irow>rowC-sqrSize  &&  irow<rowC+sqrSize ) { etaBandCells += 1 ; }
-
-          Int_t cellSM  = -999;
-          Int_t cellEta = -999;
-          Int_t cellPhi = -999;
-          if(icol > AliEMCALGeoParams::fgkEMCALCols-1)
+          for(Int_t irow = 0; irow < 5*AliEMCALGeoParams::fgkEMCALRows -1; irow++)
           {
-            cellSM = 0+int(irow/AliEMCALGeoParams::fgkEMCALRows)*2;
-            cellEta = icol-AliEMCALGeoParams::fgkEMCALCols;
-            cellPhi = irow-AliEMCALGeoParams::fgkEMCALRows*int(cellSM/2);
-          }
-          if(icol < AliEMCALGeoParams::fgkEMCALCols)
-          {
-            cellSM = 1+int(irow/AliEMCALGeoParams::fgkEMCALRows)*2;
-            cellEta = icol;
-            cellPhi = irow-AliEMCALGeoParams::fgkEMCALRows*int(cellSM/2);
-          }
+            //loop on cells in a square of side fConeSize to check cells in cone
+            if     ( Radius(colC, rowC, icol, irow) < sqrSize ) { coneCells    += 1.; }
+            else if( icol>colC-sqrSize  &&  icol<colC+sqrSize ) { phiBandCells += 1 ; }
+            else if( irow>rowC-sqrSize  &&  irow<rowC+sqrSize ) { etaBandCells += 1 ; }
 
-          if( (icol < 0 || icol > AliEMCALGeoParams::fgkEMCALCols*2-1 ||
-               irow < 0 || irow > AliEMCALGeoParams::fgkEMCALRows*5 - 1) //5*nRows+1/3*nRows //Count as bad "cells" out of EMCAL acceptance
-             || (cu->GetEMCALChannelStatus(cellSM,cellEta,cellPhi)==1))  //Count as bad "cells" marked as bad in the DataBase
-          {
-            if     ( Radius(colC, rowC, icol, irow) < sqrSize ) coneBadCellsCoeff    += 1.;
-            else if( icol>colC-sqrSize  &&  icol<colC+sqrSize ) phiBandBadCellsCoeff += 1 ;
-	          else if( irow>rowC-sqrSize  &&  irow<rowC+sqrSize ) etaBandBadCellsCoeff += 1 ;
+            if( (icol < 0 || icol > AliEMCALGeoParams::fgkEMCALCols*2-1 ||
+                 irow < 0 || irow > AliEMCALGeoParams::fgkEMCALRows*5 - 1) //5*nRows+1/3*nRows //Count as bad "cells" out of EMCAL acceptance
+               || IsBadCellInGrid(cu,icol,irow))  //Count as bad "cells" marked as bad in the DataBase
+            {
+              if     ( Radius(colC, rowC, icol, irow) < sqrSize ) coneBadCells    += 1.;
+              else if( icol>colC-sqrSize  &&  icol<colC+sqrSize ) phiBandBadCells += 1 ;
+              else if( irow>rowC-sqrSize  &&  irow<rowC+sqrSize ) etaBandBadCells += 1 ;
+            }
           }
+        }//end of cells loop
+
+        if ( cache >= 0 )
+        {
+          fConeCellsCoeff[cache  ] = sqrSize;
+          fConeCellsCoeff[cache+1] = coneCells;
+          fConeCellsCoeff[cache+2] = coneBadCells;
+          fConeCellsCoeff[cache+3] = phiBandCells;
+          fConeCellsCoeff[cache+4] = phiBandBadCells;
+          fConeCellsCoeff[cache+5] = etaBandCells;
+          fConeCellsCoeff[cache+6] = etaBandBadCells;
         }
-      }//end of cells loop
+      }
+
+      coneBadCellsCoeff    += coneBadCells;
+      phiBandBadCellsCoeff += phiBandBadCells;
+      etaBandBadCellsCoeff += etaBandBadCells;
     }
     else AliWarning("Cluster with bad (eta,phi) in EMCal for energy density coeff calculation");
 
@@ -343,6 +377,293 @@ void AliIsolationCut::GetCoeffNormBadCell(AliAODPWG4ParticleCorrelation * pCandi
   }
 }
 
+//___________________________________________________________________________________
+/// Reset the bad channel and cone cells caches when the run changes.
+//___________________________________________________________________________________
+void AliIsolationCut::CheckBadCellMapRun(AliCaloTrackReader * reader) const
+{
+  Int_t run = reader->GetInputEvent() ? reader->GetInputEvent()->GetRunNumber() : -1;
+
+  if ( run == fBadCellMapRun && fBadCellMap.GetSize() > 0 ) return;
+
+  fBadCellMapRun = run;
+
+  fBadCellMap.Set(kBadMapNCols*kBadMapNRows);
+  fBadCellMap.Reset(-1);
+
+  fConeCellsDensity.Set(3*kConeNCols*kConeNRows);
+  fConeCellsDensity.Reset(-1);
+
+  fConeCellsCoeff.Set(7*kConeNCols*kConeNRows);
+  fConeCellsCoeff.Reset(-1);
+}
+
+//___________________________________________________________________________________
+/// Check if the EMCal cell at absolute (col,row) is marked as bad in the DataBase.
+/// The status is read once per run and kept in a lookup table.
+//___________________________________________________________________________________
+Bool_t AliIsolationCut::IsBadCellInGrid(AliCalorimeterUtils * cu, Int_t icol, Int_t irow) const
+{
+  Int_t lut = -1;
+  if ( icol >= 0 && icol < kBadMapNCols && irow >= 0 && irow < kBadMapNRows ) lut = icol*kBadMapNRows+irow;
+
+  if ( lut >= 0 && fBadCellMap[lut] >= 0 ) return fBadCellMap[lut];
+
+  Int_t cellSM  = -999;
+  Int_t cellEta = -999;
+  Int_t cellPhi = -999;
+  if(icol > AliEMCALGeoParams::fgkEMCALCols-1)
+  {
+    cellSM = 0+int(irow/AliEMCALGeoParams::fgkEMCALRows)*2;
+    cellEta = icol-AliEMCALGeoParams::fgkEMCALCols;
+    cellPhi = irow-AliEMCALGeoParams::fgkEMCALRows*int(cellSM/2);
+  }
+  if(icol < AliEMCALGeoParams::fgkEMCALCols)
+  {
+    cellSM = 1+int(irow/AliEMCALGeoParams::fgkEMCALRows)*2;
+    cellEta = icol;
+    cellPhi = irow-AliEMCALGeoParams::fgkEMCALRows*int(cellSM/2);
+  }
+
+  Bool_t bad = (cu->GetEMCALChannelStatus(cellSM,cellEta,cellPhi)==1);
+
+  if ( lut >= 0 ) fBadCellMap[lut] = bad;
+
+  return bad;
+}
+
+//___________________________________________________________________________________
+/// Sort the indexed entries in eta-phi cells (counting sort).
+/// fPt, fEta, fPhi and fFlag must be filled for the nEntries first entries.
+//___________________________________________________________________________________
+void AliIsolationCut::FillIndexCells(ConeIndex & index, Int_t nEntries)
+{
+  Float_t etaMin = 0, etaMax = 0;
+  Bool_t  first  = kTRUE;
+  for(Int_t i = 0; i < nEntries; i++)
+  {
+    if ( !index.fFlag[i] ) continue;
+    if ( first || index.fEta[i] < etaMin ) etaMin = index.fEta[i];
+    if ( first || index.fEta[i] > etaMax ) etaMax = index.fEta[i];
+    first = kFALSE;
+  }
+
+  index.fEtaMin  = etaMin;
+  index.fEtaStep = (etaMax-etaMin)/kIndexNEtaBins;
+  if ( index.fEtaStep <= 0 ) index.fEtaStep = 1;
+
+  const Int_t nCells = kIndexNEtaBins*kIndexNPhiBins;
+  if ( index.fCellStart.GetSize() < nCells+1 ) index.fCellStart.Set(nCells+1);
+  index.fCellStart.Reset(0);
+  if ( index.fCellEntries.GetSize() < nEntries ) index.fCellEntries.Set(nEntries);
+
+  TArrayI cell(nEntries);
+  for(Int_t i = 0; i < nEntries; i++)
+  {
+    cell[i] = -1;
+    if ( !index.fFlag[i] ) continue;
+
+    Int_t ieta = TMath::FloorNint((index.fEta[i]-etaMin)/index.fEtaStep);
+    Int_t iphi = TMath::FloorNint(index.fPhi[i]/TMath::TwoPi()*kIndexNPhiBins);
+    ieta = TMath::Max(0,TMath::Min(ieta,kIndexNEtaBins-1));
+    iphi = TMath::Max(0,TMath::Min(iphi,kIndexNPhiBins-1));
+
+    cell[i] = ieta*kIndexNPhiBins+iphi;
+    index.fCellStart[cell[i]+1]++;
+  }
+
+  for(Int_t icell = 0; icell < nCells; icell++) index.fCellStart[icell+1] += index.fCellStart[icell];
+
+  TArrayI fill(nCells);
+  for(Int_t i = 0; i < nEntries; i++)
+  {
+    if ( cell[i] < 0 ) continue;
+    index.fCellEntries[index.fCellStart[cell[i]]+fill[cell[i]]] = i;
+    fill[cell[i]]++;
+  }
+}
+
+//___________________________________________________________________________________
+/// Index the reader track list for the current event, if not done yet.
+/// Momentum, angles and track ID are computed once per track.
+//___________________________________________________________________________________
+Bool_t AliIsolationCut::BuildTrackIndex(TObjArray * plCTS, AliCaloTrackReader * reader)
+{
+  Int_t nEntries = plCTS->GetEntriesFast();
+
+  if ( fTrackIndex.fList == plCTS && fTrackIndex.fEvent == reader->GetEventNumber() &&
+       fTrackIndex.fNEntries == nEntries ) return kTRUE;
+
+  if ( fTrackIndex.fPt.GetSize() < nEntries )
+  {
+    fTrackIndex.fPt  .Set(nEntries);
+    fTrackIndex.fEta .Set(nEntries);
+    fTrackIndex.fPhi .Set(nEntries);
+    fTrackIndex.fID  .Set(nEntries);
+    fTrackIndex.fFlag.Set(nEntries);
+  }
+
+  for(Int_t ipr = 0; ipr < nEntries; ipr++)
+  {
+    fTrackIndex.fFlag[ipr] = 0;
+
+    AliVTrack* track = dynamic_cast<AliVTrack*>(plCTS->At(ipr)) ;
+    if ( track )
+    {
+      fTrackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
+      fTrackIndex.fPt  [ipr] = fTrackVector.Pt();
+      fTrackIndex.fEta [ipr] = fTrackVector.Eta();
+      fTrackIndex.fPhi [ipr] = fTrackVector.Phi();
+      fTrackIndex.fID  [ipr] = reader->GetTrackID(track) ;
+      fTrackIndex.fFlag[ipr] = 1;
+    }
+    else
+    {
+      AliAODPWG4Particle * trackmix = dynamic_cast<AliAODPWG4Particle*>(plCTS->At(ipr)) ;
+      if ( !trackmix )
+      {
+        AliWarning("Wrong track data type, continue");
+        continue;
+      }
+
+      fTrackIndex.fPt  [ipr] = trackmix->Pt();
+      fTrackIndex.fEta [ipr] = trackmix->Eta();
+      fTrackIndex.fPhi [ipr] = trackmix->Phi();
+      fTrackIndex.fID  [ipr] = -1;
+      fTrackIndex.fFlag[ipr] = 2;
+    }
+
+    if ( fTrackIndex.fPhi[ipr] < 0 ) fTrackIndex.fPhi[ipr]+=TMath::TwoPi();
+  }
+
+  FillIndexCells(fTrackIndex, nEntries);
+
+  fTrackIndex.fList     = plCTS;
+  fTrackIndex.fEvent    = reader->GetEventNumber();
+  fTrackIndex.fNEntries = nEntries;
+
+  return kTRUE;
+}
+
+//___________________________________________________________________________________
+/// Index the reader cluster list for the current event, if not done yet.
+/// Momentum, angles and, when requested, the track matching are computed once per cluster.
+//___________________________________________________________________________________
+Bool_t AliIsolationCut::BuildClusterIndex(TObjArray * plNe, AliCaloTrackReader * reader, AliCaloPID * pid)
+{
+  Int_t  nEntries = plNe->GetEntriesFast();
+  Bool_t withTM   = fIsTMClusterInConeRejected && fPartInCone == kNeutralAndCharged;
+
+  if ( fClusterIndex.fList == plNe && fClusterIndex.fEvent == reader->GetEventNumber() &&
+       fClusterIndex.fNEntries == nEntries && fClusterIndex.fWithTM == withTM &&
+       ( !withTM || fClusterIndex.fPid == pid ) ) return kTRUE;
+
+  if ( fClusterIndex.fPt.GetSize() < nEntries )
+  {
+    fClusterIndex.fPt  .Set(nEntries);
+    fClusterIndex.fEta .Set(nEntries);
+    fClusterIndex.fPhi .Set(nEntries);
+    fClusterIndex.fID  .Set(nEntries);
+    fClusterIndex.fFlag.Set(nEntries);
+  }
+
+  for(Int_t ipr = 0; ipr < nEntries; ipr++)
+  {
+    fClusterIndex.fFlag[ipr] = 0;
+
+    AliVCluster * calo = dynamic_cast<AliVCluster *>(plNe->At(ipr)) ;
+    if ( calo )
+    {
+      // Get the index where the cluster comes, to retrieve the corresponding vertex
+      Int_t evtIndex = 0 ;
+      if (reader->GetMixedEvent())
+        evtIndex=reader->GetMixedEvent()->EventIndexForCaloCluster(calo->GetID()) ;
+
+      // Assume that come from vertex in straight line
+      calo->GetMomentum(fMomentum,reader->GetVertex(evtIndex)) ;
+
+      fClusterIndex.fPt  [ipr] = fMomentum.Pt();
+      fClusterIndex.fEta [ipr] = fMomentum.Eta();
+      fClusterIndex.fPhi [ipr] = fMomentum.Phi();
+      fClusterIndex.fID  [ipr] = calo->GetID();
+      fClusterIndex.fFlag[ipr] = 1;
+
+      if ( withTM && pid->IsTrackMatched(calo,reader->GetCaloUtils(),reader->GetInputEvent()) )
+        fClusterIndex.fFlag[ipr] += 4;
+    }
+    else
+    {
+      AliAODPWG4Particle * calomix = dynamic_cast<AliAODPWG4Particle*>(plNe->At(ipr)) ;
+      if ( !calomix )
+      {
+        AliWarning("Wrong calo data type, continue");
+        continue;
+      }
+
+      fClusterIndex.fPt  [ipr] = calomix->Pt();
+      fClusterIndex.fEta [ipr] = calomix->Eta();
+      fClusterIndex.fPhi [ipr] = calomix->Phi();
+      fClusterIndex.fID  [ipr] = -1;
+      fClusterIndex.fFlag[ipr] = 2;
+    }
+
+    if ( fClusterIndex.fPhi[ipr] < 0 ) fClusterIndex.fPhi[ipr]+=TMath::TwoPi();
+  }
+
+  FillIndexCells(fClusterIndex, nEntries);
+
+  fClusterIndex.fList     = plNe;
+  fClusterIndex.fEvent    = reader->GetEventNumber();
+  fClusterIndex.fNEntries = nEntries;
+  fClusterIndex.fWithTM   = withTM;
+  fClusterIndex.fPid      = pid;
+
+  return kTRUE;
+}
+
+//___________________________________________________________________________________
+/// Select from the index the entries that can contribute to the cone or
+/// to the UE eta and phi bands of a candidate: those in the eta band
+/// |eta-etaC| < R (all phi, it contains the cone) or in the phi band
+/// phiC-R < phi < phiC+R. Entries are kept in list order in fSelected.
+/// \return number of selected entries.
+//___________________________________________________________________________________
+Int_t AliIsolationCut::SelectFromIndex(const ConeIndex & index, Float_t etaC, Float_t phiC)
+{
+  Int_t etaLow  = TMath::FloorNint((etaC-fConeSize-index.fEtaMin)/index.fEtaStep);
+  Int_t etaHigh = TMath::FloorNint((etaC+fConeSize-index.fEtaMin)/index.fEtaStep);
+  Int_t phiLow  = TMath::FloorNint((phiC-fConeSize)/TMath::TwoPi()*kIndexNPhiBins);
+  Int_t phiHigh = TMath::FloorNint((phiC+fConeSize)/TMath::TwoPi()*kIndexNPhiBins);
+
+  etaLow  = TMath::Max(0,TMath::Min(etaLow ,kIndexNEtaBins-1));
+  etaHigh = TMath::Max(0,TMath::Min(etaHigh,kIndexNEtaBins-1));
+  phiLow  = TMath::Max(0,TMath::Min(phiLow ,kIndexNPhiBins-1));
+  phiHigh = TMath::Max(0,TMath::Min(phiHigh,kIndexNPhiBins-1));
+
+  if ( fSelected.GetSize() < index.fNEntries ) fSelected.Set(index.fNEntries);
+
+  Int_t nSelected = 0;
+  for(Int_t ieta = 0; ieta < kIndexNEtaBins; ieta++)
+  {
+    Bool_t inEtaBand = (ieta >= etaLow && ieta <= etaHigh);
+    for(Int_t iphi = (inEtaBand ? 0 : phiLow); iphi <= (inEtaBand ? kIndexNPhiBins-1 : phiHigh); iphi++)
+    {
+      Int_t icell = ieta*kIndexNPhiBins+iphi;
+      for(Int_t ientry = index.fCellStart[icell]; ientry < index.fCellStart[icell+1]; ientry++)
+        fSelected[nSelected++] = index.fCellEntries[ientry];
+    }
+  }
+
+  // Keep the order of the list, so that sums and reference arrays are the same as without index
+  TArrayI sorted(nSelected);
+  TMath::Sort(nSelected, fSelected.GetArray(), sorted.GetArray(), kFALSE);
+  TArrayI selected(nSelected);
+  for(Int_t i = 0; i < nSelected; i++) selected[i] = fSelected[sorted[i]];
+  for(Int_t i = 0; i < nSelected; i++) fSelected[i] = selected[i];
+
+  return nSelected;
+}
+
 //____________________________________________
 // Put data member values in string to keep
 // in output container.
@@ -460,11 +781,41 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
   if(plCTS &&
      (fPartInCone==kOnlyCharged || fPartInCone==kNeutralAndCharged))
   {
-    for(Int_t ipr = 0;ipr < plCTS->GetEntries() ; ipr ++ )
+    // With the index, only the tracks in the eta and phi bands of the candidate are visited
+    Bool_t useIndex = fUseConeIndex && plCTS == reader->GetCTSTracks() && BuildTrackIndex(plCTS,reader);
+    Int_t  nLoop    = useIndex ? SelectFromIndex(fTrackIndex,etaC,phiC) : plCTS->GetEntries();
+    
+    for(Int_t iloop = 0;iloop < nLoop ; iloop ++ )
     {
-      AliVTrack* track = dynamic_cast<AliVTrack*>(plCTS->At(ipr)) ;
+      Int_t ipr = useIndex ? fSelected[iloop] : iloop;
       
-      if(track)
+      AliVTrack* track = 0x0;
+      
+      if(useIndex)
+      {
+        if(!fTrackIndex.fFlag[ipr]) continue ;
+        
+        if(fTrackIndex.fFlag[ipr] == 1)
+        {
+          track = (AliVTrack*) plCTS->At(ipr) ;
+          
+          // Do not count the candidate or its daughters, see below
+          if ( pCandidate->GetDetectorTag() == AliFiducialCut::kCTS )
+          {
+            Bool_t contained = kFALSE;
+            for(Int_t i = 0; i < 4; i++)
+            {
+              if( fTrackIndex.fID[ipr] == pCandidate->GetTrackLabel(i) ) contained = kTRUE;
+            }
+            if ( contained ) continue ;
+          }
+        }
+        
+        pt  = fTrackIndex.fPt [ipr];
+        eta = fTrackIndex.fEta[ipr];
+        phi = fTrackIndex.fPhi[ipr];
+      }
+      else if((track = dynamic_cast<AliVTrack*>(plCTS->At(ipr))))
       {
         // In case of isolation of single tracks or conversion photon (2 tracks) or pi0 (4 tracks),
         // do not count the candidate or the daughters of the candidate
@@ -606,11 +957,38 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
      (fPartInCone==kOnlyNeutral || fPartInCone==kNeutralAndCharged))
   {
     
-    for(Int_t ipr = 0;ipr < plNe->GetEntries() ; ipr ++ )
+    // With the index, only the clusters in the eta and phi bands of the candidate are visited
+    Bool_t useIndex = fUseConeIndex && (plNe == reader->GetEMCALClusters() || plNe == reader->GetPHOSClusters()) &&
+                      BuildClusterIndex(plNe,reader,pid);
+    Int_t  nLoop    = useIndex ? SelectFromIndex(fClusterIndex,etaC,phiC) : plNe->GetEntries();
+    
+    for(Int_t iloop = 0;iloop < nLoop ; iloop ++ )
     {
-      AliVCluster * calo = dynamic_cast<AliVCluster *>(plNe->At(ipr)) ;
+      Int_t ipr = useIndex ? fSelected[iloop] : iloop;
+      
+      AliVCluster * calo = 0x0;
       
-      if(calo)
+      if(useIndex)
+      {
+        if(!fClusterIndex.fFlag[ipr]) continue ;
+        
+        if(fClusterIndex.fFlag[ipr] & 1)
+        {
+          calo = (AliVCluster*) plNe->At(ipr) ;
+          
+          // Do not count the candidate (photon or pi0) or the daughters of the candidate
+          if(fClusterIndex.fID[ipr] == pCandidate->GetCaloLabel(0) ||
+             fClusterIndex.fID[ipr] == pCandidate->GetCaloLabel(1)   ) continue ;
+          
+          // Skip matched clusters with tracks in case of neutral+charged analysis
+          if(fClusterIndex.fFlag[ipr] & 4) continue ;
+        }
+        
+        pt  = fClusterIndex.fPt [ipr];
+        eta = fClusterIndex.fEta[ipr];
+        phi = fClusterIndex.fPhi[ipr];
+      }
+      else if((calo = dynamic_cast<AliVCluster *>(plNe->At(ipr))))
       {
         // Get the index where the cluster comes, to retrieve the corresponding vertex
         Int_t evtIndex = 0 ;
@@ -896,6 +1274,7 @@ void AliIsolationCut::Print(const Option_t * opt) const
   printf("particle type in cone =  %d\n",    fPartInCone ) ;
   printf("using fraction for high pt leading instead of frac ? %i\n",fFracIsThresh);
   printf("minimum distance to candidate, R>%1.2f\n",fDistMinToTrigger);
+  printf("use eta-phi index of tracks/clusters ? %d\n",fUseConeIndex);
   printf("    \n") ;
 }
 
@@ -21,11 +21,15 @@
 #include <TObject.h>
 class TObjArray ;
 #include <TLorentzVector.h>
+#include <TArrayF.h>
+#include <TArrayI.h>
+#include <TArrayC.h>
 
 // --- ANALYSIS system ---
 class AliAODPWG4ParticleCorrelation ;
 class AliCaloTrackReader ;
 class AliCaloPID;
+class AliCalorimeterUtils;
 
 class AliIsolationCut : public TObject {
 
@@ -108,9 +112,52 @@ class AliIsolationCut : public TObject {
   void       SetFracIsThresh(Bool_t f )                        { fFracIsThresh      = f    ; }
   void       SetTrackMatchedClusterRejectionInCone(Bool_t tm)  { fIsTMClusterInConeRejected = tm ; }
   void       SetMinDistToTrigger(Float_t md)                   { fDistMinToTrigger  = md   ; }
+  void       SetUseConeIndex(Bool_t use)                       { fUseConeIndex      = use  ; }
+  Bool_t     IsConeIndexUsed()        const { return fUseConeIndex   ; }
     
  private:
 
+  /// \struct ConeIndex
+  /// Eta-phi binned index of the tracks or clusters of the reader lists, built once per event.
+  /// Cone and UE band sums of every candidate only visit the cells crossed by the
+  /// eta and phi bands around the candidate.
+  struct ConeIndex
+  {
+    ConeIndex() : fList(0), fEvent(-1), fNEntries(-1), fPid(0), fWithTM(kFALSE),
+                  fEtaMin(0), fEtaStep(1), fPt(), fEta(), fPhi(), fID(), fFlag(), fCellStart(), fCellEntries() { ; }
+
+    const TObjArray * fList;        ///< Indexed list.
+    Int_t      fEvent;              ///< Reader event number of the index.
+    Int_t      fNEntries;           ///< Entries of the list when indexed.
+    const AliCaloPID * fPid;        ///< PID used for the cluster-track matching flag.
+    Bool_t     fWithTM;             ///< Cluster-track matching flag filled.
+    Float_t    fEtaMin;             ///< Lower eta edge of the grid.
+    Float_t    fEtaStep;            ///< Eta width of the grid cells.
+    TArrayF    fPt;                 ///< Transverse momentum per entry.
+    TArrayF    fEta;                ///< Pseudorapidity per entry.
+    TArrayF    fPhi;                ///< Azimuth in [0,2pi] per entry.
+    TArrayI    fID;                 ///< Track ID (via reader) or cluster ID per entry.
+    TArrayC    fFlag;               ///< 0 unusable entry, 1 track/cluster, 2 mixed event particle; +4 track matched cluster.
+    TArrayI    fCellStart;          ///< First position in fCellEntries per cell, one more than cells.
+    TArrayI    fCellEntries;        ///< Entries sorted by cell.
+  };
+
+  enum { kIndexNEtaBins = 20, kIndexNPhiBins = 36 } ;
+
+  enum { kBadMapNCols = 97, kBadMapNRows = 129, kConeNCols = 96, kConeNRows = 240 } ;
+
+  Bool_t     BuildTrackIndex  (TObjArray * plCTS, AliCaloTrackReader * reader) ;
+
+  Bool_t     BuildClusterIndex(TObjArray * plNe , AliCaloTrackReader * reader, AliCaloPID * pid) ;
+
+  void       FillIndexCells   (ConeIndex & index, Int_t nEntries) ;
+
+  Int_t      SelectFromIndex  (const ConeIndex & index, Float_t etaC, Float_t phiC) ;
+
+  Bool_t     IsBadCellInGrid  (AliCalorimeterUtils * cu, Int_t icol, Int_t irow) const ;
+
+  void       CheckBadCellMapRun(AliCaloTrackReader * reader) const ;
+
   Float_t    fConeSize ;         ///< Size of the isolation cone
 
   Float_t    fPtThreshold ;      ///< Minimum pt of the particles in the cone or sum in cone (UE pt mean in the forward region cone)
@@ -139,6 +186,22 @@ class AliIsolationCut : public TObject {
 
   TVector3   fTrackVector;       //!<! Track moment, temporal object.
 
+  Bool_t     fUseConeIndex;      ///< Use the per-event eta-phi index of the reader track and cluster lists.
+
+  ConeIndex  fTrackIndex;        //!<! Index of the reader tracks.
+
+  ConeIndex  fClusterIndex;      //!<! Index of the reader clusters.
+
+  TArrayI    fSelected;          //!<! Entries selected from the index for the current candidate, sorted.
+
+  mutable Int_t   fBadCellMapRun;        //!<! Run number of the bad cell and cone caches.
+
+  mutable TArrayC fBadCellMap;           //!<! EMCal bad channel status per absolute (col,row), -1 not yet read.
+
+  mutable TArrayF fConeCellsDensity;     //!<! Per candidate (col,row): cone size in cells, cells and bad cells in cone.
+
+  mutable TArrayF fConeCellsCoeff;       //!<! Per candidate (col,row): cone size in cells, cells and bad cells in cone, phi band and eta band.
+
   /// Copy constructor not implemented.
   AliIsolationCut(              const AliIsolationCut & g) ;
 
@@ -146,7 +209,7 @@ class AliIsolationCut : public TObject {
   AliIsolationCut & operator = (const AliIsolationCut & g) ; 
 
   /// \cond CLASSIMP
-  ClassDef(AliIsolationCut,11) ;
+  ClassDef(AliIsolationCut,12) ;
   /// \endcond
 
 } ;
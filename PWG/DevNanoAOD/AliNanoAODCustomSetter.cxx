@@ -1,3 +1,74 @@
 #include "AliNanoAODCustomSetter.h"
+#include "AliNanoAODTrack.h"
+#include "AliNanoAODTrackMapping.h"
+#include "AliLog.h"
+#include "TObjArray.h"
+#include "TObjString.h"
 
 ClassImp(AliNanoAODCustomSetter)
+
+void AliNanoAODCustomSetter::SetColumnPrecision(const char * var, Int_t nbits) {
+  // Keep only nbits of mantissa for the track variable var.
+  // nbits >= 23 means full float precision
+  if (nbits < 0) {
+    AliError(Form("Invalid number of mantissa bits (%d) for column %s", nbits, var));
+    return;
+  }
+  if (fColumnPrecision.Length()) fColumnPrecision += ",";
+  fColumnPrecision += Form("%s:%d", var, nbits);
+  fColumnsResolved = kFALSE;
+}
+
+void AliNanoAODCustomSetter::ResolveColumnPrecision() {
+  // Translate the variable names into track mapping indexes. Done once,
+  // the mapping is fixed after the first track has been created
+  AliNanoAODTrackMapping * mapping = AliNanoAODTrackMapping::GetInstance();
+  fColumnBits.assign(mapping->GetSize(), -1);
+
+  TObjArray * tokens = fColumnPrecision.Tokenize(",");
+  for (Int_t itoken = 0; itoken < tokens->GetEntriesFast(); itoken++) {
+    TString token = ((TObjString*)tokens->At(itoken))->String();
+    Int_t colon = token.Last(':');
+    if (colon <= 0) {
+      AliError(Form("Malformed column precision \"%s\"", token.Data()));
+      continue;
+    }
+    TString var = token(0, colon);
+    var = var.Strip(TString::kBoth);
+    Int_t nbits = TString(token(colon+1, token.Length())).Atoi();
+    Int_t index = mapping->GetVarIndex(var);
+    if (index < 0 || index >= (Int_t)fColumnBits.size()) {
+      AliError(Form("Column %s not in the track variable list, precision not reduced", var.Data()));
+      continue;
+    }
+    fColumnBits[index] = nbits;
+  }
+  delete tokens;
+  fColumnsResolved = kTRUE;
+}
+
+void AliNanoAODCustomSetter::ReduceTrackPrecision(AliNanoAODTrack * spTrack) {
+  // Apply the configured precision to all the columns of the track.
+  // Called by the replicator after SetNanoAODTrack
+  if (!fColumnPrecision.Length()) return;
+  if (!fColumnsResolved) ResolveColumnPrecision();
+
+  const Int_t ncolumns = fColumnBits.size();
+  for (Int_t index = 0; index < ncolumns; index++) {
+    if (fColumnBits[index] < 0) continue;
+    spTrack->SetVar(index, TruncateMantissa(spTrack->GetVar(index), fColumnBits[index]));
+  }
+}
+
+Double_t AliNanoAODCustomSetter::TruncateMantissa(Double_t val, Int_t nbits) {
+  // Round val to the nearest float with only nbits of mantissa.
+  // Inf and NaN are left untouched
+  if (nbits < 0 || nbits >= 23) return val;
+  union { Float_t f; UInt_t i; } word;
+  word.f = (Float_t)val;
+  if ((word.i & 0x7f800000) == 0x7f800000) return word.f;
+  const UInt_t drop = 23 - nbits;
+  word.i += 1u << (drop - 1);
+  word.i &= ~((1u << drop) - 1);
+  return word.f;
+}
@@ -9,6 +9,8 @@
 // Author: Michele Floris, michele.floris@cern.ch
 
 #include "TNamed.h"
+#include "TString.h"
+#include <vector>
 
 class AliAODEvent;
 class AliAODTrack;
@@ -19,12 +21,28 @@ class AliNanoAODTrack;
 class AliNanoAODCustomSetter : public TNamed
 {
 public:
-  AliNanoAODCustomSetter(const char * name = "AliNanoAODCustomSetter") : TNamed(name,name) {;}
+  AliNanoAODCustomSetter(const char * name = "AliNanoAODCustomSetter") : TNamed(name,name), fColumnPrecision(""), fColumnBits(), fColumnsResolved(kFALSE) {;}
   virtual ~AliNanoAODCustomSetter() {;}
   virtual void SetNanoAODHeader(const AliAODEvent * event   , AliNanoAODHeader * head  ) =0;
   virtual void SetNanoAODTrack (const AliAODTrack * aodTrack, AliNanoAODTrack * spTrack) =0;
 
-  ClassDef(AliNanoAODCustomSetter, 1)
+  // Precision-reduced track columns: only nbits of the float mantissa
+  // are kept for the variable var (e.g. 10 bits ~ half precision for
+  // pt, theta, phi). The zeroed low bits compress away in the output
+  // tree. The list is stored as "var:nbits,var:nbits,..."
+  void  SetColumnPrecision(const char * var, Int_t nbits);
+  const char * GetColumnPrecision() const { return fColumnPrecision; }
+  void  ReduceTrackPrecision(AliNanoAODTrack * spTrack);
+  static Double_t TruncateMantissa(Double_t val, Int_t nbits);
+
+private:
+  void  ResolveColumnPrecision();
+
+  TString fColumnPrecision; // list of precision-reduced columns, "var:nbits,..."
+  std::vector<Int_t> fColumnBits; //! mantissa bits per track mapping index (-1 = full precision)
+  Bool_t  fColumnsResolved; //! fColumnBits is up to date with fColumnPrecision
+
+  ClassDef(AliNanoAODCustomSetter, 2)
 };
 
 
@@ -137,19 +137,19 @@ void AliNanoAODReplicator::SelectParticle(Int_t i)
   // of negative daughter and mother
   // IDs when setting!
   
-  if (!IsParticleSelected(TMath::Abs(i)))
-  {
-    fParticleSelected.Add(TMath::Abs(i),1);    
-  }
+  Int_t index = TMath::Abs(i);
+  if (index >= (Int_t)fParticleSelected.size()) fParticleSelected.resize(index+1, 0);
+  if (!fParticleSelected[index]) fParticleSelected[index] = 1;
 }
 
 //_____________________________________________________________________________
-Bool_t AliNanoAODReplicator::IsParticleSelected(Int_t i)  
+Bool_t AliNanoAODReplicator::IsParticleSelected(Int_t i) const
 {
   // taking the absolute values here, need to take 
   // care with negative daughter and mother
   // IDs when setting!
-  return (fParticleSelected.GetValue(TMath::Abs(i))==1);
+  Int_t index = TMath::Abs(i);
+  return (index < (Int_t)fParticleSelected.size() && fParticleSelected[index]);
 }
 
 
@@ -163,35 +163,34 @@ void AliNanoAODReplicator::CreateLabelMap(const AliAODEvent& source)
   // actually kept.
   //
   
-  fLabelMap.Delete();
+  // Labels of particles which are not kept map to 0.
   
   TClonesArray* mcParticles = static_cast<TClonesArray*>(source.FindListObject(AliAODMCParticle::StdBranchName()));
   
-  Int_t j(0);
-  Int_t i(0); // We need i, we cannot rely on part->GetLabel, because some of the original mc particles are not kept in the stack, apparently
+  Int_t nmc = mcParticles ? mcParticles->GetEntriesFast() : 0;
+  fLabelMap.assign(nmc, 0);
   
-  TIter next(mcParticles);
-
-  while ( next() )
+  Int_t j(0);
+  // We need i, we cannot rely on part->GetLabel, because some of the original mc particles are not kept in the stack, apparently
+  for (Int_t i = 0; i < nmc; i++)
   {
     if (IsParticleSelected(i))
     {
-      fLabelMap.Add(i,j++);
-      //      std::cout << i <<  "->" << j-1 << std::endl;
+      fLabelMap[i] = j++;
     }
-    ++i;
   }  
 
 
 }
 
 //_____________________________________________________________________________
-Int_t AliNanoAODReplicator::GetNewLabel(Int_t i) 
+Int_t AliNanoAODReplicator::GetNewLabel(Int_t i) const
 {
   // Gets the label from the new created Map
   // Call CreatLabelMap before
   // otherwise only 0 returned
-  return fLabelMap.GetValue(TMath::Abs(i));
+  Int_t index = TMath::Abs(i);
+  return index < (Int_t)fLabelMap.size() ? fLabelMap[index] : 0;
 }
 
 //_____________________________________________________________________________
@@ -203,7 +202,9 @@ void AliNanoAODReplicator::FilterMC(const AliAODEvent& source)
   AliAODMCHeader* mcHeader(0x0);
   TClonesArray* mcParticles(0x0);
   
-  fParticleSelected.Delete();
+  // flat flags, sized on the input stack and reused from event to event
+  mcParticles = static_cast<TClonesArray*>(source.FindListObject(AliAODMCParticle::StdBranchName()));
+  fParticleSelected.assign(mcParticles ? mcParticles->GetEntriesFast() : 0, 0);
 
   //  std::cout << "MC Mode: " << fMCMode << ", Tracks " << fTracks->GetEntries() << std::endl;
   
@@ -220,8 +221,6 @@ void AliNanoAODReplicator::FilterMC(const AliAODEvent& source)
     }
   
   
-  mcParticles = static_cast<TClonesArray*>(source.FindListObject(AliAODMCParticle::StdBranchName()));
-  
   if ( mcParticles && fMCMode>=2 )
     {
       // keep all primaries
@@ -255,7 +254,10 @@ void AliNanoAODReplicator::FilterMC(const AliAODEvent& source)
       
 	  while ( label >= 0 ) 
 	    {
+	      // the ancestors of this particle were already walked for a previous track
+	      if (label < (Int_t)fParticleSelected.size() && fParticleSelected[label] == 2) break;
 	      SelectParticle(label);
+	      fParticleSelected[label] = 2;
 	      AliAODMCParticle* mother = static_cast<AliAODMCParticle*>(mcParticles->UncheckedAt(label));
 	      if (!mother)
 		{
@@ -481,7 +483,10 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
 
     AliNanoAODTrack * special = new((*fTracks)[ntracks++]) AliNanoAODTrack (aodtrack, fVarList);
     
-    if(fCustomSetter) fCustomSetter->SetNanoAODTrack(aodtrack, special);
+    if(fCustomSetter) {
+      fCustomSetter->SetNanoAODTrack(aodtrack, special);
+      fCustomSetter->ReduceTrackPrecision(special);
+    }
   }  
   //----------------------------------------------------------
   
@@ -10,11 +10,8 @@
 #ifndef ALIDAODBRANCHREPLICATOR_H
 #  include "AliAODBranchReplicator.h"
 #endif
-#ifndef ROOT_TExMap
-#  include "TExMap.h"
-#endif
-
 #include <iostream>
+#include <vector>
 
 /* #ifndef AliAOD3LH_H */
 /* #include "AliAOD3LH.h" */
@@ -92,9 +89,9 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
  private:
 
   void SelectParticle(Int_t i);
-  Bool_t IsParticleSelected(Int_t i);
+  Bool_t IsParticleSelected(Int_t i) const;
   void CreateLabelMap(const AliAODEvent& source);
-  Int_t GetNewLabel(Int_t i);
+  Int_t GetNewLabel(Int_t i) const;
   void FilterMC(const AliAODEvent& source);
  
 
@@ -113,8 +110,8 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   mutable AliAODMCHeader* fMCHeader; //! internal array of MC header
   Int_t fMCMode; // MC filtering switch (0=none=no mc information,1=normal=simple copy,>=2=aggressive=filter out : keep only particles leading to tracks and trheir relatives + all charged primaries)
 
-  TExMap fLabelMap; //! for MC label remapping (in case of aggressive filtering)
-  TExMap fParticleSelected; //! List of selected MC particles
+  std::vector<Int_t> fLabelMap; //! for MC label remapping (in case of aggressive filtering), indexed by the original label
+  std::vector<Char_t> fParticleSelected; //! selected MC particles, indexed by the original label (0=no,1=yes,2=yes and ancestors)
 			
   TString fVarList; // list of variables to be filterered
   TString fVarListHeader; // list of variables to be filtered (header)
@@ -127,7 +124,7 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   AliNanoAODReplicator(const AliNanoAODReplicator&);
   AliNanoAODReplicator& operator=(const AliNanoAODReplicator&);
   
-  ClassDef(AliNanoAODReplicator,1) // Branch replicator for ESD to muon AOD.
+  ClassDef(AliNanoAODReplicator,2) // Branch replicator for ESD to muon AOD.
 };
 
 #endif
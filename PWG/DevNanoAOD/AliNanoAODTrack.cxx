@@ -21,6 +21,7 @@
 //-------------------------------------------------------------------------
 
 #include <TVector3.h>
+#include <TClonesArray.h>
 #include "AliLog.h"
 #include "AliExternalTrackParam.h"
 #include "AliVVertex.h"
@@ -534,3 +535,35 @@ void  AliNanoAODTrack::Clear(Option_t * /*opt*/) {
   fVars.clear();
   fNVars = 0;
 }
+
+//_______________________________________________________
+Int_t AliNanoAODTrack::GetColumn(const TClonesArray * tracks, Int_t index, Double_t * column) {
+  // Copy variable index of all the tracks into column (structure of
+  // arrays view of the event). column must hold at least
+  // tracks->GetEntriesFast() values. Returns the number of values copied
+  if (!tracks || index < 0) return 0;
+  const Int_t ntracks = tracks->GetEntriesFast();
+  for (Int_t itrack = 0; itrack < ntracks; itrack++)
+    column[itrack] = static_cast<const AliNanoAODTrack*>(tracks->UncheckedAt(itrack))->GetVar(index);
+  return ntracks;
+}
+
+//_______________________________________________________
+Int_t AliNanoAODTrack::GetColumn(const TClonesArray * tracks, const char * var, Double_t * column) {
+  // Same as above, by variable name
+  return GetColumn(tracks, AliNanoAODTrackMapping::GetInstance()->GetVarIndex(var), column);
+}
+
+//_______________________________________________________
+Int_t AliNanoAODTrack::GetColumns(const TClonesArray * tracks, Int_t nvars, const Int_t * indexes, Double_t ** columns) {
+  // Copy nvars variables at once, visiting each track only once.
+  // columns[ivar] receives variable indexes[ivar]
+  if (!tracks) return 0;
+  const Int_t ntracks = tracks->GetEntriesFast();
+  for (Int_t itrack = 0; itrack < ntracks; itrack++) {
+    const AliNanoAODTrack * track = static_cast<const AliNanoAODTrack*>(tracks->UncheckedAt(itrack));
+    for (Int_t ivar = 0; ivar < nvars; ivar++)
+      columns[ivar][itrack] = track->GetVar(indexes[ivar]);
+  }
+  return ntracks;
+}
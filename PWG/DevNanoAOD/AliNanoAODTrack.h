@@ -65,6 +65,7 @@ class AliTPCdEdxInfo;
 class AliAODEvent;
 class AliAODTrack;
 class AliESDTrack;
+class TClonesArray;
 
 class AliNanoAODTrack : public AliVTrack, public AliNanoAODStorage {
 
@@ -83,6 +84,12 @@ public:
 
 
   virtual void Clear(Option_t * opt) ;
+
+  // Columnar access: copy one variable of all the tracks of the event
+  // into a contiguous array (one mapping lookup for the whole event)
+  static Int_t GetColumn(const TClonesArray * tracks, Int_t index, Double_t * column);
+  static Int_t GetColumn(const TClonesArray * tracks, const char * var, Double_t * column);
+  static Int_t GetColumns(const TClonesArray * tracks, Int_t nvars, const Int_t * indexes, Double_t ** columns);
   
   // kinematics
   virtual Double_t OneOverPt() const { return (Pt() != 0.) ? 1./Pt() : -999.; }
@@ -600,6 +600,151 @@ void THistManager::FillProfile(const char* name, double x, double y, double weig
   hist->Fill(x, y, weight);
 }
 
+THistManager::Handle<TH1> THistManager::GetTH1Handle(const char *name, Option_t *opt) const {
+  TH1 *hist = dynamic_cast<TH1 *>(FindHistogramForHandle(name, "THistManager::GetTH1Handle"));
+  if(!hist){
+    Fatal("THistManager::GetTH1Handle", "Object %s is not a 1D histogram", name);
+    return Handle<TH1>();
+  }
+  return Handle<TH1>(hist, DecodeWidthMask(opt, 1, false));
+}
+
+THistManager::Handle<TH2> THistManager::GetTH2Handle(const char *name, Option_t *opt) const {
+  TH2 *hist = dynamic_cast<TH2 *>(FindHistogramForHandle(name, "THistManager::GetTH2Handle"));
+  if(!hist){
+    Fatal("THistManager::GetTH2Handle", "Object %s is not a 2D histogram", name);
+    return Handle<TH2>();
+  }
+  return Handle<TH2>(hist, DecodeWidthMask(opt, 2, false));
+}
+
+THistManager::Handle<TH3> THistManager::GetTH3Handle(const char *name, Option_t *opt) const {
+  TH3 *hist = dynamic_cast<TH3 *>(FindHistogramForHandle(name, "THistManager::GetTH3Handle"));
+  if(!hist){
+    Fatal("THistManager::GetTH3Handle", "Object %s is not a 3D histogram", name);
+    return Handle<TH3>();
+  }
+  return Handle<TH3>(hist, DecodeWidthMask(opt, 3, false));
+}
+
+THistManager::Handle<THnSparse> THistManager::GetTHnSparseHandle(const char *name, Option_t *opt) const {
+  THnSparse *hist = dynamic_cast<THnSparse *>(FindHistogramForHandle(name, "THistManager::GetTHnSparseHandle"));
+  if(!hist){
+    Fatal("THistManager::GetTHnSparseHandle", "Object %s is not a THnSparse", name);
+    return Handle<THnSparse>();
+  }
+  return Handle<THnSparse>(hist, DecodeWidthMask(opt, hist->GetNdimensions(), true));
+}
+
+THistManager::Handle<TProfile> THistManager::GetProfileHandle(const char *name) const {
+  TProfile *hist = dynamic_cast<TProfile *>(FindHistogramForHandle(name, "THistManager::GetProfileHandle"));
+  if(!hist){
+    Fatal("THistManager::GetProfileHandle", "Object %s is not a profile histogram", name);
+    return Handle<TProfile>();
+  }
+  return Handle<TProfile>(hist);
+}
+
+void THistManager::FillTH1(const Handle<TH1> &hist, double x, double weight) {
+  if(hist.GetWidthMask()) weight *= BinWidthWeight(hist->GetXaxis(), x);
+  hist->Fill(x, weight);
+}
+
+void THistManager::FillTH1(const Handle<TH1> &hist, int n, const double *x, const double *weights) {
+  if(!hist.GetWidthMask()){
+    hist->FillN(n, x, weights);
+    return;
+  }
+  const TAxis *xaxis = hist->GetXaxis();
+  for(int i = 0; i < n; i++) hist->Fill(x[i], (weights ? weights[i] : 1.) * BinWidthWeight(xaxis, x[i]));
+}
+
+void THistManager::FillTH2(const Handle<TH2> &hist, double x, double y, double weight) {
+  UInt_t mask = hist.GetWidthMask();
+  if(mask){
+    if(mask & 1) weight *= BinWidthWeight(hist->GetXaxis(), x);
+    if(mask & 2) weight *= BinWidthWeight(hist->GetYaxis(), y);
+  }
+  hist->Fill(x, y, weight);
+}
+
+void THistManager::FillTH2(const Handle<TH2> &hist, int n, const double *x, const double *y, const double *weights) {
+  if(!hist.GetWidthMask()){
+    hist->FillN(n, x, y, weights);
+    return;
+  }
+  for(int i = 0; i < n; i++) FillTH2(hist, x[i], y[i], weights ? weights[i] : 1.);
+}
+
+void THistManager::FillTH3(const Handle<TH3> &hist, double x, double y, double z, double weight) {
+  UInt_t mask = hist.GetWidthMask();
+  if(mask){
+    if(mask & 1) weight *= BinWidthWeight(hist->GetXaxis(), x);
+    if(mask & 2) weight *= BinWidthWeight(hist->GetYaxis(), y);
+    if(mask & 4) weight *= BinWidthWeight(hist->GetZaxis(), z);
+  }
+  hist->Fill(x, y, z, weight);
+}
+
+void THistManager::FillTH3(const Handle<TH3> &hist, int n, const double *x, const double *y, const double *z, const double *weights) {
+  // TH3 does not provide a FillN
+  for(int i = 0; i < n; i++) FillTH3(hist, x[i], y[i], z[i], weights ? weights[i] : 1.);
+}
+
+void THistManager::FillTHnSparse(const Handle<THnSparse> &hist, const double *x, double weight) {
+  UInt_t mask = hist.GetWidthMask();
+  if(mask){
+    for(Int_t iaxis = 0; iaxis < hist->GetNdimensions(); iaxis++){
+      if(mask & (1u << iaxis)) weight *= BinWidthWeight(hist->GetAxis(iaxis), x[iaxis]);
+    }
+  }
+  hist->Fill(x, weight);
+}
+
+void THistManager::FillProfile(const Handle<TProfile> &hist, double x, double y, double weight) {
+  hist->Fill(x, y, weight);
+}
+
+void THistManager::FillProfile(const Handle<TProfile> &hist, int n, const double *x, const double *y, const double *weights) {
+  hist->FillN(n, x, y, weights);
+}
+
+TObject *THistManager::FindHistogramForHandle(const char *name, const char *caller) const {
+  TString dirname(basename(name)), hname(histname(name));
+  THashList *parent(FindGroup(dirname));
+  if(!parent){
+    Fatal(caller, "Parent group %s does not exist", dirname.Data());
+    return nullptr;
+  }
+  TObject *hist = parent->FindObject(hname);
+  if(!hist){
+    Fatal(caller, "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
+    return nullptr;
+  }
+  return hist;
+}
+
+UInt_t THistManager::DecodeWidthMask(Option_t *opt, int ndim, bool numbered) {
+  TString optstring(opt);
+  optstring.ToLower();
+  if(!optstring.Contains("w")) return 0;
+  if(ndim == 1 && !numbered) return 1;
+  const char *axisnames[3] = {"wx", "wy", "wz"};
+  UInt_t mask = 0;
+  for(int iaxis = 0; iaxis < ndim && iaxis < 31; iaxis++){
+    if(numbered){
+      if(optstring.Contains(Form("w%d", iaxis))) mask |= (1u << iaxis);
+    } else if(iaxis < 3 && optstring.Contains(axisnames[iaxis])) mask |= (1u << iaxis);
+  }
+  return mask;
+}
+
+double THistManager::BinWidthWeight(const TAxis *axis, double x) {
+  Int_t bin = axis->FindFixBin(x);
+  if(bin < 1 || bin > axis->GetNbins()) return 1.;
+  return 1./axis->GetBinWidth(bin);
+}
+
 TObject *THistManager::FindObject(const char *name) const {
 	TString dirname(basename(name)), hname(histname(name));
 	THashList *parent(FindGroup(dirname));
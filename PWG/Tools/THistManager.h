@@ -95,6 +95,27 @@ class TProfile;
  * an argument for options. Automatic correction for the bin width is done when
  * specifying the argument *W*, followed by the direction. Adding multiple directions
  * the weight is calculated for all directions at the same time.
+ *
+ * ## Filling via handles
+ *
+ * The name-based Fill methods resolve the histogram path, look up the
+ * histogram in its group and parse the option string for every entry.
+ * For histograms filled in tight loops the lookup can be done once, i.e.
+ * in UserCreateOutputObjects, by requesting a typed handle. Filling via
+ * the handle is a direct call on the histogram, the bin width correction
+ * is resolved when the handle is created. Batched Fill methods accept
+ * arrays of values. When filling via handles the bin width correction
+ * multiplies the weight given by the caller, and it is applied to all bins
+ * inside the axis range, underflow and overflow entries keep their weight.
+ * A *W* option without direction has no effect on 2D, 3D and nD handles.
+ *
+ * ~~~{.cxx}
+ * THistManager::Handle<TH1> hpt = mgr.GetTH1Handle("hPt");
+ * for(auto en : ROOT::TSeqI(0, 10000) {
+ *   mgr.FillTH1(hpt, gRandom->Exp(-1));
+ * }
+ * mgr.FillTH1(hpt, ntracks, ptvalues);
+ * ~~~
  */
 class THistManager : public TNamed {
 public:
@@ -229,6 +250,55 @@ public:
     iterator();
   };
 
+  /**
+   * @class Handle
+   * @brief Typed reference to a histogram inside the container
+   * @ingroup Histmanager
+   *
+   * Lightweight handle obtained once from the Get...Handle methods of the
+   * histogram manager. It keeps the pointer to the histogram and the axes
+   * for which the bin width correction was requested, so that filling via
+   * the handle does not need any string operation.
+   */
+  template<typename T>
+  class Handle {
+  public:
+    /**
+     * @brief Dummy constructor, creating an invalid handle
+     */
+    Handle(): fHist(nullptr), fWidthMask(0) {}
+
+    /**
+     * @brief Constructor
+     * @param[in] hist Histogram the handle refers to
+     * @param[in] widthmask Axes (bit 0 for x, bit 1 for y, ...) for which the bin width correction is applied
+     */
+    Handle(T *hist, UInt_t widthmask = 0): fHist(hist), fWidthMask(widthmask) {}
+
+    /**
+     * @brief Access to the underlying histogram
+     * @return Histogram the handle refers to
+     */
+    T *Get() const { return fHist; }
+    T *operator->() const { return fHist; }
+
+    /**
+     * @brief Check whether the handle refers to a histogram
+     * @return True if the histogram is set
+     */
+    bool IsValid() const { return fHist != nullptr; }
+
+    /**
+     * @brief Get the axes for which the bin width correction is applied
+     * @return Bit mask (bit 0 for x, bit 1 for y, ...)
+     */
+    UInt_t GetWidthMask() const { return fWidthMask; }
+
+  private:
+    T *fHist;                 ///< Histogram the handle refers to
+    UInt_t fWidthMask;        ///< Axes with bin width correction
+  };
+
   /**
    * @brief Default constructor.
    *
@@ -621,6 +691,133 @@ public:
 	 */
   void FillProfile(const char *name, double x, double y, double weight = 1.);
 
+  /**
+   * @brief Get a handle to a 1D histogram within the container.
+   *
+   * The histogram name also contains the parent group(s)
+   * according to the common group notation. The lookup and
+   * the option parsing are done only once here.
+   * @param[in] name Name of the histogram
+   * @param[in] opt Filling arguments applied for all fills via the handle
+   * @return Handle to the histogram
+   */
+  Handle<TH1> GetTH1Handle(const char *name, Option_t *opt = "") const;
+
+  /**
+   * @brief Get a handle to a 2D histogram within the container.
+   * @param[in] name Name of the histogram
+   * @param[in] opt Filling arguments applied for all fills via the handle
+   * @return Handle to the histogram
+   */
+  Handle<TH2> GetTH2Handle(const char *name, Option_t *opt = "") const;
+
+  /**
+   * @brief Get a handle to a 3D histogram within the container.
+   * @param[in] name Name of the histogram
+   * @param[in] opt Filling arguments applied for all fills via the handle
+   * @return Handle to the histogram
+   */
+  Handle<TH3> GetTH3Handle(const char *name, Option_t *opt = "") const;
+
+  /**
+   * @brief Get a handle to a nD histogram within the container.
+   * @param[in] name Name of the histogram
+   * @param[in] opt Filling arguments applied for all fills via the handle (w<axis>)
+   * @return Handle to the histogram
+   */
+  Handle<THnSparse> GetTHnSparseHandle(const char *name, Option_t *opt = "") const;
+
+  /**
+   * @brief Get a handle to a profile histogram within the container.
+   * @param[in] name Name of the profile histogram
+   * @return Handle to the histogram
+   */
+  Handle<TProfile> GetProfileHandle(const char *name) const;
+
+  /**
+   * @brief Fill a 1D histogram via its handle.
+   * @param[in] hist Handle to the histogram
+   * @param[in] x x-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void FillTH1(const Handle<TH1> &hist, double x, double weight = 1.);
+
+  /**
+   * @brief Fill a 1D histogram via its handle with n entries.
+   * @param[in] hist Handle to the histogram
+   * @param[in] n Number of entries
+   * @param[in] x x-coordinates
+   * @param[in] weights optional weights of the entries (NULL: weight 1)
+   */
+  void FillTH1(const Handle<TH1> &hist, int n, const double *x, const double *weights = nullptr);
+
+  /**
+   * @brief Fill a 2D histogram via its handle.
+   * @param[in] hist Handle to the histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void FillTH2(const Handle<TH2> &hist, double x, double y, double weight = 1.);
+
+  /**
+   * @brief Fill a 2D histogram via its handle with n entries.
+   * @param[in] hist Handle to the histogram
+   * @param[in] n Number of entries
+   * @param[in] x x-coordinates
+   * @param[in] y y-coordinates
+   * @param[in] weights optional weights of the entries (NULL: weight 1)
+   */
+  void FillTH2(const Handle<TH2> &hist, int n, const double *x, const double *y, const double *weights = nullptr);
+
+  /**
+   * @brief Fill a 3D histogram via its handle.
+   * @param[in] hist Handle to the histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] z z-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void FillTH3(const Handle<TH3> &hist, double x, double y, double z, double weight = 1.);
+
+  /**
+   * @brief Fill a 3D histogram via its handle with n entries.
+   * @param[in] hist Handle to the histogram
+   * @param[in] n Number of entries
+   * @param[in] x x-coordinates
+   * @param[in] y y-coordinates
+   * @param[in] z z-coordinates
+   * @param[in] weights optional weights of the entries (NULL: weight 1)
+   */
+  void FillTH3(const Handle<TH3> &hist, int n, const double *x, const double *y, const double *z, const double *weights = nullptr);
+
+  /**
+   * @brief Fill a nD histogram via its handle.
+   * @param[in] hist Handle to the histogram
+   * @param[in] x coordinates of the data
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void FillTHnSparse(const Handle<THnSparse> &hist, const double *x, double weight = 1.);
+
+  /**
+   * @brief Fill a profile histogram via its handle.
+   * @param[in] hist Handle to the profile histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void FillProfile(const Handle<TProfile> &hist, double x, double y, double weight = 1.);
+
+  /**
+   * @brief Fill a profile histogram via its handle with n entries.
+   * @param[in] hist Handle to the profile histogram
+   * @param[in] n Number of entries
+   * @param[in] x x-coordinates
+   * @param[in] y y-coordinates
+   * @param[in] weights optional weights of the entries (NULL: weight 1)
+   */
+  void FillProfile(const Handle<TProfile> &hist, int n, const double *x, const double *y, const double *weights = nullptr);
+
   /**
    * @brief Create forward iterator starting at the beginning of the
    * container
@@ -706,6 +903,35 @@ private:
 	 */
 	TString histname(const TString &path) const;
 
+	/**
+	 * @brief Find a histogram for the creation of a handle.
+	 *
+	 * Raises a fatal error if the histogram does not exist.
+	 * @param[in] name Path of the histogram
+	 * @param[in] caller Name of the calling method for the error message
+	 * @return The histogram
+	 */
+	TObject *FindHistogramForHandle(const char *name, const char *caller) const;
+
+	/**
+	 * @brief Decode the bin width correction from the fill options
+	 * @param[in] opt Fill option (w for the x-direction in 1D, wx/wy/wz, or w<axis> for nD)
+	 * @param[in] ndim Number of dimensions of the histogram
+	 * @param[in] numbered If true the axes are identified by numbers (THnSparse)
+	 * @return Bit mask of the axes with bin width correction
+	 */
+	static UInt_t DecodeWidthMask(Option_t *opt, int ndim, bool numbered);
+
+	/**
+	 * @brief Weight correcting for the bin width at a given position.
+	 *
+	 * Multiplies the weight of the entry in the handle-based Fill methods.
+	 * @param[in] axis Axis to check
+	 * @param[in] x Position on the axis
+	 * @return 1/bin width for the bins 1 to nbins, 1 for underflow and overflow
+	 */
+	static double BinWidthWeight(const TAxis *axis, double x);
+
 	THashList *fHistos;                   ///< List of histograms
 	bool fIsOwner;                        ///< Set the ownership
 
@@ -65,6 +65,7 @@
 #include "TPythia6Decayer.h"
 #include "TParticle.h"
 #include "TBits.h"
+#include "TParameter.h"
 ClassImp(AliAnalysisTaskCFTree)
 
 //-----------------------------------------------------------------------------
@@ -163,6 +164,16 @@ fStoreMuonOrigin(0),
 fApplyPhysicsSelectionCut(0),
 fStoreOnlyEventsWithMuons(0),
 fStoreCutBitsInTrackMask(0),
+fStoreFlatTracks(0),
+fNFlatTracks(0),
+fNFlatTrackExtra(0),
+fNFlatTrackPar(0),
+fFlatTrackPt(0x0),
+fFlatTrackEta(0x0),
+fFlatTrackPhi(0x0),
+fFlatTrackCharge(0x0),
+fFlatTrackMask(0x0),
+fFlatTrackExtra(0x0),
 fDecayArray(0x0),
 fDecayer(0x0),
 fMapping(0x0)
@@ -183,6 +194,18 @@ fMapping(0x0)
 //-----------------------------------------------------------------------------
 
 
+//-----------------------------------------------------------------------------
+AliAnalysisTaskCFTree::~AliAnalysisTaskCFTree(){
+  delete [] fFlatTrackPt;
+  delete [] fFlatTrackEta;
+  delete [] fFlatTrackPhi;
+  delete [] fFlatTrackCharge;
+  delete [] fFlatTrackMask;
+  delete [] fFlatTrackExtra;
+}
+//-----------------------------------------------------------------------------
+
+
 //-----------------------------------------------------------------------------
 void AliAnalysisTaskCFTree::UserCreateOutputObjects(){
   fListOfHistos = new TList();
@@ -264,7 +287,7 @@ void AliAnalysisTaskCFTree::UserCreateOutputObjects(){
   fTree->Branch("nchCL1mc",&fNchCL1mc);
   fTree->Branch("evcutspassed",&fEventCutsPassed);
 
-  if (fTracks)      fTree->Branch("tracks",&fTracks);
+  if (fTracks && !fStoreFlatTracks) fTree->Branch("tracks",&fTracks);
   if (fTracklets)   fTree->Branch("tracklets",&fTracklets);
   if (fMuons)       fTree->Branch("muons",&fMuons);
   if (fMcParticles) fTree->Branch("mcparticles",&fMcParticles);
@@ -308,6 +331,29 @@ void AliAnalysisTaskCFTree::UserCreateOutputObjects(){
 
   fTree->GetUserInfo()->Add(fMapping);	//to retreive it afterwards one needs fTree->GetUserInfo()->At(0)
 
+  if (fTracks && fStoreFlatTracks) {
+    fNFlatTrackPar = 0;
+    for (Int_t i=0; i<AliCFTreeMapping::kMappingTracks; i++) if (fMapping->MappingTracks()[i]>=0) fNFlatTrackPar++;
+    // stride of trackExtra, ntrackExtra/ntracks is undefined for events without tracks
+    fTree->GetUserInfo()->Add(new TParameter<Int_t>("nTrackExtraPar",fNFlatTrackPar));
+    fFlatTrackPt     = new Float_t[kMaxFlatTracks];
+    fFlatTrackEta    = new Float_t[kMaxFlatTracks];
+    fFlatTrackPhi    = new Float_t[kMaxFlatTracks];
+    fFlatTrackCharge = new Short_t[kMaxFlatTracks];
+    fFlatTrackMask   = new UInt_t[kMaxFlatTracks];
+    fTree->Branch("ntracks",&fNFlatTracks,"ntracks/I");
+    fTree->Branch("trackPt",fFlatTrackPt,"trackPt[ntracks]/F");
+    fTree->Branch("trackEta",fFlatTrackEta,"trackEta[ntracks]/F");
+    fTree->Branch("trackPhi",fFlatTrackPhi,"trackPhi[ntracks]/F");
+    fTree->Branch("trackCharge",fFlatTrackCharge,"trackCharge[ntracks]/S");
+    fTree->Branch("trackMask",fFlatTrackMask,"trackMask[ntracks]/i");
+    if (fNFlatTrackPar>0) {
+      fFlatTrackExtra = new Float_t[kMaxFlatTracks*fNFlatTrackPar];
+      fTree->Branch("ntrackExtra",&fNFlatTrackExtra,"ntrackExtra/I");
+      fTree->Branch("trackExtra",fFlatTrackExtra,"trackExtra[ntrackExtra]/F");
+    }
+  }
+
   fUtils = new AliAnalysisUtils();
   fUtils->SetUseSPDCutInMultBins(kTRUE);
   //  fUtils->SetMinPlpContribSPD(3);
@@ -813,6 +859,8 @@ void AliAnalysisTaskCFTree::UserExec(Option_t *){
     fNchCL1mc = countNchCL1Mc;
   }
 
+  if (fFlatTrackPt) FillFlatTracks();
+
   if (!fStoreOnlyEventsWithMuons) fTree->Fill();
   else { if (fMuons) if (fMuons->GetEntriesFast()>0) fTree->Fill(); }
 
@@ -822,6 +870,30 @@ void AliAnalysisTaskCFTree::UserExec(Option_t *){
 //-----------------------------------------------------------------------------
 
 
+//-----------------------------------------------------------------------------
+void AliAnalysisTaskCFTree::FillFlatTracks(){
+  // Copy the selected AliCFParticle tracks into the flat tree arrays
+  fNFlatTracks = fTracks->GetEntriesFast();
+  if (fNFlatTracks>kMaxFlatTracks) {
+    AliWarning(Form("%d tracks selected, only the first %d are stored",fNFlatTracks,kMaxFlatTracks));
+    fNFlatTracks = kMaxFlatTracks;
+  }
+  fNFlatTrackExtra = 0;
+  for (Int_t i=0; i<fNFlatTracks; i++) {
+    AliCFParticle* part = (AliCFParticle*) fTracks->UncheckedAt(i);
+    fFlatTrackPt[i]     = part->Pt();
+    fFlatTrackEta[i]    = part->Eta();
+    fFlatTrackPhi[i]    = part->Phi();
+    fFlatTrackCharge[i] = part->Charge();
+    fFlatTrackMask[i]   = part->Mask();
+    if (!fFlatTrackExtra) continue;
+    for (Int_t ipar=0; ipar<fNFlatTrackPar; ipar++)
+      fFlatTrackExtra[fNFlatTrackExtra++] = ipar<part->GetSize() ? part->At(ipar) : 0;
+  }
+}
+//-----------------------------------------------------------------------------
+
+
 //-----------------------------------------------------------------------------
 UInt_t AliAnalysisTaskCFTree::GetFilterMap(const AliVTrack* track){
   UInt_t mask = 0;
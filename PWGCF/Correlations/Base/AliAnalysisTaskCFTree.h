@@ -29,8 +29,9 @@ class TPythia6Decayer;
 
 class AliAnalysisTaskCFTree : public AliAnalysisTaskSE {
  public:
+  enum { kMaxFlatTracks=10000 }; // capacity of the flat track arrays
   AliAnalysisTaskCFTree(const char* name="AliAnalysisTaskCFTree");
-  virtual ~AliAnalysisTaskCFTree(){};
+  virtual ~AliAnalysisTaskCFTree();
   virtual void UserCreateOutputObjects();
   virtual void UserExec(Option_t *option);
 
@@ -68,12 +69,20 @@ class AliAnalysisTaskCFTree : public AliAnalysisTaskSE {
   void SetApplyPhysicsSelectionCut(Bool_t val=kTRUE) { fApplyPhysicsSelectionCut = val; }
   void SetStoreOnlyEventsWithMuons(Bool_t val=kTRUE) { fStoreOnlyEventsWithMuons = val; }
   void SetStoreCutBitsInTrackMask(Bool_t val=kTRUE)  { fStoreCutBitsInTrackMask  = val; }
+  // Store the selected tracks as flat arrays (one branch per quantity) instead of AliCFParticles:
+  // ntracks, trackPt[ntracks], trackEta[ntracks], trackPhi[ntracks], trackCharge[ntracks], trackMask[ntracks]
+  // and, if additional track info is requested, trackExtra[ntrackExtra] with the AliCFParticle data
+  // of track i at [i*npar,(i+1)*npar). The stride npar is stored as TParameter<Int_t> "nTrackExtraPar"
+  // in the user info (fTree->GetUserInfo()->FindObject("nTrackExtraPar")), do not derive it from
+  // ntrackExtra/ntracks which is undefined for events without tracks
+  void SetStoreFlatTracks(Bool_t val=kTRUE)  { fStoreFlatTracks  = val; }
  protected:
   AliAnalysisTaskCFTree(const  AliAnalysisTaskCFTree &task);
   AliAnalysisTaskCFTree& operator=(const  AliAnalysisTaskCFTree &task);
 
   UInt_t GetFilterMap(const AliVTrack* part);
   AliCFParticle* AddTrack(const AliVTrack* track, UInt_t mask, UInt_t flag=0);
+  void FillFlatTracks();
 
   AliAnalysisFilter* fTrackFilter; // track filter used in ESD analysis
   UInt_t fHybridConstrainedMask;       // Filter mask for hybrid constrained tracks (ESD analysis)
@@ -173,10 +182,20 @@ class AliAnalysisTaskCFTree : public AliAnalysisTaskSE {
   Bool_t fApplyPhysicsSelectionCut; // skip events not passing fSelectionBit mask
   Bool_t fStoreOnlyEventsWithMuons; // if kTRUE store only events with at least one muon
   Bool_t fStoreCutBitsInTrackMask;  // if kTRUE modify additional bits in track mask
+  Bool_t fStoreFlatTracks;    // if kTRUE - tracks are stored as flat arrays instead of AliCFParticles
+  Int_t fNFlatTracks;         //! tree var: number of tracks in the flat arrays
+  Int_t fNFlatTrackExtra;     //! tree var: size of the flat array of additional track info
+  Int_t fNFlatTrackPar;       //! number of additional parameters per track
+  Float_t* fFlatTrackPt;      //! tree var: track pt
+  Float_t* fFlatTrackEta;     //! tree var: track eta
+  Float_t* fFlatTrackPhi;     //! tree var: track phi
+  Short_t* fFlatTrackCharge;  //! tree var: track charge
+  UInt_t* fFlatTrackMask;     //! tree var: track mask
+  Float_t* fFlatTrackExtra;   //! tree var: additional track info
   TClonesArray* fDecayArray;
   TPythia6Decayer* fDecayer;
 
-  ClassDef(AliAnalysisTaskCFTree,9);
+  ClassDef(AliAnalysisTaskCFTree,10);
 };
 #endif
 
@@ -89,6 +89,8 @@ AliAnalysisTaskReducedTreeMaker::AliAnalysisTaskReducedTreeMaker() :
   fRejectPileup(kFALSE),
   fTreeWritingOption(kBaseEventsWithBaseTracks),
   fWriteTree(kTRUE),
+  fTreeBasketSize(16000),
+  fTreeAutoFlush(0),
   fWriteEventsWithNoSelectedTracks(kTRUE),
   fFillTrackInfo(kTRUE),
   fFillV0Info(kTRUE),
@@ -145,6 +147,8 @@ AliAnalysisTaskReducedTreeMaker::AliAnalysisTaskReducedTreeMaker(const char *nam
   fRejectPileup(kFALSE),
   fTreeWritingOption(kBaseEventsWithBaseTracks),
   fWriteTree(writeTree),
+  fTreeBasketSize(16000),
+  fTreeAutoFlush(0),
   fWriteEventsWithNoSelectedTracks(kTRUE),
   fFillTrackInfo(kTRUE),
   fFillV0Info(kTRUE),
@@ -231,8 +235,10 @@ void AliAnalysisTaskReducedTreeMaker::UserCreateOutputObjects()
         break;
   };
  
-  if(fWriteTree)
-    fTree->Branch("Event",&fReducedEvent,16000,99);
+  if(fWriteTree) {
+    fTree->Branch("Event",&fReducedEvent,fTreeBasketSize,99);
+    if(fTreeAutoFlush>0) fTree->SetAutoFlush(fTreeAutoFlush);
+  }
 
   // if user set active branches
   TObjArray* aractive=fActiveBranches.Tokenize(";");
@@ -82,6 +82,11 @@ public:
   // Suppress writing the tree to disk
   void SetWriteTree(Bool_t option=kTRUE)  {fWriteTree = option;}
   Bool_t WriteTree() const {return fWriteTree;}
+  // Output tree layout: basket size of the split (one branch per data member) event branch
+  // and number of entries per cluster (0 = ROOT default); larger baskets and fixed clusters
+  // make the reading of a few columns through the tree cache cheaper
+  void SetTreeBasketSize(Int_t size=16000)  {fTreeBasketSize = size;}
+  void SetTreeAutoFlush(Long64_t nEntries=0) {fTreeAutoFlush = nEntries;}
   
   // Toggle on/off information branches
   void SetFillTrackInfo(Bool_t flag=kTRUE)        {fFillTrackInfo = flag;}
@@ -114,6 +119,8 @@ public:
   
   Int_t    fTreeWritingOption;     // one of the options described by ETreeWritingOptions
   Bool_t fWriteTree;                   // if kFALSE don't write the tree, use task only to produce on the fly reduced events
+  Int_t fTreeBasketSize;               // basket size of the event branch
+  Long64_t fTreeAutoFlush;             // entries per tree cluster (0 = ROOT default)
   Bool_t fWriteEventsWithNoSelectedTracks;   // write events without any selected tracks
   
   Bool_t fFillTrackInfo;             // fill track information
@@ -176,6 +183,6 @@ public:
   AliAnalysisTaskReducedTreeMaker(const AliAnalysisTaskReducedTreeMaker &c);
   AliAnalysisTaskReducedTreeMaker& operator= (const AliAnalysisTaskReducedTreeMaker &c);
 
-  ClassDef(AliAnalysisTaskReducedTreeMaker, 3); //Analysis Task for creating a reduced event information tree 
+  ClassDef(AliAnalysisTaskReducedTreeMaker, 4); //Analysis Task for creating a reduced event information tree 
 };
 #endif
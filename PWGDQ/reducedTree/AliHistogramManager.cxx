@@ -48,7 +48,14 @@ AliHistogramManager::AliHistogramManager() :
   fBinsAllocated(0),
   fVariableNames(),
   fVariableUnits(),
-  fNVars(0)
+  fNVars(0),
+  fFillPlanValid(kFALSE),
+  fFillPlanClassStart(),
+  fFillPlanHist(),
+  fFillPlanType(),
+  fFillPlanWeight(),
+  fFillPlanVarStart(),
+  fFillPlanVars()
 {
   //
   // Constructor
@@ -70,7 +77,14 @@ AliHistogramManager::AliHistogramManager(const Char_t* name, Int_t nvars) :
   fBinsAllocated(0),
   fVariableNames(),
   fVariableUnits(),
-  fNVars(nvars)
+  fNVars(nvars),
+  fFillPlanValid(kFALSE),
+  fFillPlanClassStart(),
+  fFillPlanHist(),
+  fFillPlanType(),
+  fFillPlanWeight(),
+  fFillPlanVarStart(),
+  fFillPlanVars()
 {
   //
   // Constructor
@@ -130,6 +144,7 @@ void AliHistogramManager::AddHistClass(const Char_t* histClass) {
   hList->SetOwner(kTRUE);
   hList->SetName(histClass);
   fMainList.Add(hList);
+  fFillPlanValid = kFALSE;
 }
 
 //_________________________________________________________________
@@ -144,6 +159,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
   // add a histogram
   //
   THashList* hList = (THashList*)fMainList.FindObject(histClass);
+  fFillPlanValid = kFALSE;
   if(!hList) {
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram list " << histClass << " not found!" << endl;
     cout << "         Histogram not created" << endl;
@@ -280,6 +296,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
   // add a histogram
   //
   THashList* hList = (THashList*)fMainList.FindObject(histClass);
+  fFillPlanValid = kFALSE;
   if(!hList) {
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram list " << histClass << " not found!" << endl;
     cout << "         Histogram not created" << endl;
@@ -418,6 +435,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
   // add a multi-dimensional histogram THnF
   //
   THashList* hList = (THashList*)fMainList.FindObject(histClass);
+  fFillPlanValid = kFALSE;
   if(!hList) {
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram list " << histClass << " not found!" << endl;
     cout << "         Histogram not created" << endl;
@@ -467,6 +485,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
   // add a multi-dimensional histogram THnF with equal or variable bin widths
   //
   THashList* hList = (THashList*)fMainList.FindObject(histClass);
+  fFillPlanValid = kFALSE;
   if(!hList) {
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram list " << histClass << " not found!" << endl;
     cout << "         Histogram not created" << endl;
@@ -599,139 +618,164 @@ THnF* AliHistogramManager::CreateHistogram( const Char_t* name, const Char_t* ti
 
 
 //__________________________________________________________________
-void AliHistogramManager::FillHistClass(const Char_t* className, Float_t* values) {
-  //
-  //  fill a class of histograms
-  //
-  THashList* hList = (THashList*)fMainList.FindObject(className);
-  if(!hList) {
-    /*cout << "Warning in AliHistogramManager::FillHistClass(): Histogram list " << className << " not found!" << endl;
-    cout << "         Histogram list not filled" << endl; */
-    return;
-  }
-  if(!hList) {
-    return;
-  }
+void AliHistogramManager::CompileFillPlans() {
+  //
+  // Build the fill plans of all histogram classes: decode the histogram type, the fill
+  // variables and the weight variable encoded in the unique IDs of the histograms and axes.
+  // Histograms with variables which are not in use are not added to the plan.
+  // The unique ID of each histogram list is set to its class index + 1.
+  //
+  fFillPlanClassStart.clear();
+  fFillPlanHist.clear();
+  fFillPlanType.clear();
+  fFillPlanWeight.clear();
+  fFillPlanVarStart.clear();
+  fFillPlanVars.clear();
+  
+  TIter nextClass(&fMainList);
+  THashList* hList=0x0;
+  Int_t iclass=0;
+  while((hList=(THashList*)nextClass())) {
+    hList->SetUniqueID(++iclass);
+    fFillPlanClassStart.push_back(fFillPlanHist.size());
     
-  TIter next(hList);
-  TObject* h=0x0;
-  Bool_t isProfile;
-  Bool_t isTHn;
-  Int_t thnDim=0;
-  Double_t fillValues[20]={0.0};
-  Int_t uid = 0;
-  Int_t varX=-1, varY=-1, varZ=-1, varT=-1, varW=-1;
-  Int_t dimension=0;
-  while((h=next())) {
-    Bool_t allVarsGood = kTRUE;
-    uid = h->GetUniqueID();
-    isProfile = (uid%10==1 ? kTRUE : kFALSE);   // units digit encodes the isProfile
-    isTHn = ((uid%100)>10 ? kTRUE : kFALSE);      
-    if(isTHn) thnDim = (uid%100)-10;        // the excess over 10 from the last 2 digits give the dimension of the THn
-    dimension = 0;
-    if(!isTHn) dimension = ((TH1*)h)->GetDimension();
-        
-    uid = (uid-(uid%100))/100;
-    varX = -1;
-    varY = -1;
-    varZ = -1;
-    varT = -1;
-    varW = -1;
-    if(uid>0) {
-      varW = uid%(fNVars+1)-1;
-      if(varW==0) varW=AliReducedVarManager::kNothing;
-      uid = (uid-(uid%(fNVars+1)))/(fNVars+1);
-      if(uid>0) varT = uid - 1;
-      //cout << "Filling " << h->GetName() << " with varT " << varT << endl;
-    }
-        
-    if(!isTHn) {
-      varX = ((TH1*)h)->GetXaxis()->GetUniqueID();
-      if(fUsedVars[varX]) {
+    TIter next(hList);
+    TObject* h=0x0;
+    while((h=next())) {
+      Int_t uid = h->GetUniqueID();
+      Bool_t isProfile = (uid%10==1 ? kTRUE : kFALSE);   // units digit encodes the isProfile
+      Bool_t isTHn = ((uid%100)>10 ? kTRUE : kFALSE);      
+      Int_t thnDim = 0;
+      if(isTHn) thnDim = (uid%100)-10;        // the excess over 10 from the last 2 digits give the dimension of the THn
+      Int_t dimension = 0;
+      if(!isTHn) dimension = ((TH1*)h)->GetDimension();
+      
+      uid = (uid-(uid%100))/100;
+      Int_t varT = -1, varW = -1;
+      if(uid>0) {
+        varW = uid%(fNVars+1)-1;
+        if(varW==0) varW=AliReducedVarManager::kNothing;
+        uid = (uid-(uid%(fNVars+1)))/(fNVars+1);
+        if(uid>0) varT = uid - 1;
+      }
+      
+      Int_t type = -1;
+      Int_t vars[20];
+      Int_t nvars = 0;
+      if(!isTHn) {
+        vars[nvars++] = ((TH1*)h)->GetXaxis()->GetUniqueID();
         switch(dimension) {
           case 1:
-            if(isProfile) {
-              varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-              if(!fUsedVars[varY]) break;
-              if(varW>AliReducedVarManager::kNothing) { 
-                if(!fUsedVars[varW]) break;
-                ((TProfile*)h)->Fill(values[varX],values[varY],values[varW]);
-              }
-              else 
-                ((TProfile*)h)->Fill(values[varX],values[varY]);
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH1F*)h)->Fill(values[varX],values[varW]);
-              }
-              else
-                ((TH1F*)h)->Fill(values[varX]);
-            }
+            if(isProfile) vars[nvars++] = ((TH1*)h)->GetYaxis()->GetUniqueID();
+            type = (isProfile ? kFillProfile : kFillTH1);
           break;
           case 2:
-            varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-            if(!fUsedVars[varY]) break;
-            if(isProfile) {
-              varZ = ((TH1*)h)->GetZaxis()->GetUniqueID();
-              if(!fUsedVars[varZ]) break;
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TProfile2D*)h)->Fill(values[varX],values[varY],values[varZ],values[varW]);
-              }
-              else
-                ((TProfile2D*)h)->Fill(values[varX],values[varY],values[varZ]);        
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH2F*)h)->Fill(values[varX],values[varY], values[varW]);
-              }
-              else
-                ((TH2F*)h)->Fill(values[varX],values[varY]);
-            }
+            vars[nvars++] = ((TH1*)h)->GetYaxis()->GetUniqueID();
+            if(isProfile) vars[nvars++] = ((TH1*)h)->GetZaxis()->GetUniqueID();
+            type = (isProfile ? kFillProfile2D : kFillTH2);
           break;
           case 3:
-            varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-            if(!fUsedVars[varY]) break;
-            varZ = ((TH1*)h)->GetZaxis()->GetUniqueID();
-            if(!fUsedVars[varZ]) break;
-            if(isProfile) {
-              if(!fUsedVars[varT]) break;
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TProfile3D*)h)->Fill(values[varX],values[varY],values[varZ],values[varT],values[varW]);
-              }
-              else
-                ((TProfile3D*)h)->Fill(values[varX],values[varY],values[varZ],values[varT]);
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH3F*)h)->Fill(values[varX],values[varY],values[varZ],values[varW]);
-              }
-              else
-                ((TH3F*)h)->Fill(values[varX],values[varY],values[varZ]);
-            }
+            vars[nvars++] = ((TH1*)h)->GetYaxis()->GetUniqueID();
+            vars[nvars++] = ((TH1*)h)->GetZaxis()->GetUniqueID();
+            if(isProfile) vars[nvars++] = varT;
+            type = (isProfile ? kFillProfile3D : kFillTH3);
           break;
           default:
           break;
-        }  // end switch
+        }
       }
-    }  // end if(!isTHn)
-    else {
-      for(Int_t idim=0;idim<thnDim;++idim) {
-        allVarsGood &= fUsedVars[((THnF*)h)->GetAxis(idim)->GetUniqueID()];
-        fillValues[idim] = values[((THnF*)h)->GetAxis(idim)->GetUniqueID()];
+      else {
+        for(Int_t idim=0;idim<thnDim && idim<20;++idim)
+          vars[nvars++] = ((THnF*)h)->GetAxis(idim)->GetUniqueID();
+        type = kFillTHn;
       }
-      if(allVarsGood) {
-        if(varW>AliReducedVarManager::kNothing) {
-          if(fUsedVars[varW])
-            ((THnF*)h)->Fill(fillValues,values[varW]);
-        }
-        else
-          ((THnF*)h)->Fill(fillValues);
+      if(type<0) continue;
+      
+      Bool_t allVarsGood = kTRUE;
+      for(Int_t i=0;i<nvars;++i) allVarsGood &= (vars[i]>=0 && fUsedVars[vars[i]]);
+      if(varW>AliReducedVarManager::kNothing) allVarsGood &= fUsedVars[varW];
+      if(!allVarsGood) continue;
+      
+      fFillPlanHist.push_back(h);
+      fFillPlanType.push_back(type);
+      fFillPlanWeight.push_back(varW>AliReducedVarManager::kNothing ? varW : AliReducedVarManager::kNothing);
+      fFillPlanVarStart.push_back(fFillPlanVars.size());
+      for(Int_t i=0;i<nvars;++i) fFillPlanVars.push_back(vars[i]);
+    }
+  }
+  fFillPlanClassStart.push_back(fFillPlanHist.size());
+  fFillPlanVarStart.push_back(fFillPlanVars.size());
+  fFillPlanValid = kTRUE;
+}
+
+//__________________________________________________________________
+Int_t AliHistogramManager::GetHistClassIndex(const Char_t* className) {
+  //
+  // index of a histogram class, to be used with FillHistClass(Int_t, Float_t*)
+  //
+  if(!fFillPlanValid) CompileFillPlans();
+  THashList* hList = (THashList*)fMainList.FindObject(className);
+  if(!hList) return -1;
+  return (Int_t)hList->GetUniqueID()-1;
+}
+
+//__________________________________________________________________
+void AliHistogramManager::FillHistClass(const Char_t* className, Float_t* values) {
+  //
+  //  fill a class of histograms
+  //
+  FillHistClass(GetHistClassIndex(className), values);
+}
+
+//__________________________________________________________________
+void AliHistogramManager::FillHistClass(Int_t classIdx, Float_t* values) {
+  //
+  //  fill a class of histograms following its fill plan
+  //
+  if(!fFillPlanValid) CompileFillPlans();
+  if(classIdx<0 || classIdx+1>=(Int_t)fFillPlanClassStart.size()) return;
+  
+  Double_t fillValues[20]={0.0};
+  const Int_t last = fFillPlanClassStart[classIdx+1];
+  for(Int_t ie=fFillPlanClassStart[classIdx]; ie<last; ++ie) {
+    TObject* h = fFillPlanHist[ie];
+    const Int_t* v = &fFillPlanVars[fFillPlanVarStart[ie]];
+    const Int_t varW = fFillPlanWeight[ie];
+    const Bool_t weighted = (varW>AliReducedVarManager::kNothing);
+    switch(fFillPlanType[ie]) {
+      case kFillTH1:
+        if(weighted) ((TH1F*)h)->Fill(values[v[0]],values[varW]);
+        else ((TH1F*)h)->Fill(values[v[0]]);
+      break;
+      case kFillProfile:
+        if(weighted) ((TProfile*)h)->Fill(values[v[0]],values[v[1]],values[varW]);
+        else ((TProfile*)h)->Fill(values[v[0]],values[v[1]]);
+      break;
+      case kFillTH2:
+        if(weighted) ((TH2F*)h)->Fill(values[v[0]],values[v[1]],values[varW]);
+        else ((TH2F*)h)->Fill(values[v[0]],values[v[1]]);
+      break;
+      case kFillProfile2D:
+        if(weighted) ((TProfile2D*)h)->Fill(values[v[0]],values[v[1]],values[v[2]],values[varW]);
+        else ((TProfile2D*)h)->Fill(values[v[0]],values[v[1]],values[v[2]]);
+      break;
+      case kFillTH3:
+        if(weighted) ((TH3F*)h)->Fill(values[v[0]],values[v[1]],values[v[2]],values[varW]);
+        else ((TH3F*)h)->Fill(values[v[0]],values[v[1]],values[v[2]]);
+      break;
+      case kFillProfile3D:
+        if(weighted) ((TProfile3D*)h)->Fill(values[v[0]],values[v[1]],values[v[2]],values[v[3]],values[varW]);
+        else ((TProfile3D*)h)->Fill(values[v[0]],values[v[1]],values[v[2]],values[v[3]]);
+      break;
+      case kFillTHn: {
+        const Int_t nvars = fFillPlanVarStart[ie+1]-fFillPlanVarStart[ie];
+        for(Int_t idim=0;idim<nvars;++idim) fillValues[idim] = values[v[idim]];
+        if(weighted) ((THnF*)h)->Fill(fillValues,values[varW]);
+        else ((THnF*)h)->Fill(fillValues);
       }
+      break;
+      default:
+      break;
     }
   }
 }
@@ -14,6 +14,8 @@
 #include <TList.h>
 #include <THashList.h>
 
+#include <vector>
+
 #include "AliReducedVarManager.h"
 
 class TAxis;
@@ -65,6 +67,8 @@ class AliHistogramManager : public TObject {
                         TAxis* axis);
   
   void FillHistClass(const Char_t* className, Float_t* values);
+  void FillHistClass(Int_t classIdx, Float_t* values);
+  Int_t GetHistClassIndex(const Char_t* className);   // index to be used with FillHistClass(Int_t, Float_t*), -1 if not found
   
   void SetUseDefaultVariableNames(Bool_t flag) {fUseDefaultVariableNames = flag;};
   void SetDefaultVarNames(TString* vars, TString* units);
@@ -101,9 +105,23 @@ class AliHistogramManager : public TObject {
   TString fVariableUnits[AliReducedVarManager::kNVars];               //! variable units
   Int_t fNVars;                          // maximum number of variables
   
+  // Fill plans: the histogram type, fill variables and weight of all histograms, decoded once
+  // from the unique IDs of histograms and axes and stored as flat arrays, one block per histogram class
+  enum EFillPlanType {
+    kFillTH1=0, kFillTH2, kFillTH3, kFillProfile, kFillProfile2D, kFillProfile3D, kFillTHn
+  };
+  Bool_t fFillPlanValid;                         //! fill plans are up to date with the histogram lists
+  std::vector<Int_t> fFillPlanClassStart;        //! first plan entry of each histogram class (last element = number of entries)
+  std::vector<TObject*> fFillPlanHist;           //! histogram of each plan entry
+  std::vector<Int_t> fFillPlanType;              //! EFillPlanType of each plan entry
+  std::vector<Int_t> fFillPlanWeight;            //! weight variable of each plan entry (kNothing if none)
+  std::vector<Int_t> fFillPlanVarStart;          //! first variable of each plan entry in fFillPlanVars (last element = size of fFillPlanVars)
+  std::vector<Int_t> fFillPlanVars;              //! fill variables, in the order of the Fill() arguments
+  
   void MakeAxisLabels(TAxis* ax, const Char_t* labels);
+  void CompileFillPlans();
   
-  ClassDef(AliHistogramManager, 3)
+  ClassDef(AliHistogramManager, 4)
 };
 
 #endif
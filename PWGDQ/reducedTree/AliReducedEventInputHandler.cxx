@@ -5,6 +5,8 @@
 
 #include <TTree.h>
 #include <TFile.h>
+#include <TObjArray.h>
+#include <TObjString.h>
 #include "AliReducedEventInputHandler.h"
 #include "AliReducedBaseEvent.h"
 #include "AliReducedEventInfo.h"
@@ -15,6 +17,8 @@ ClassImp(AliReducedEventInputHandler)
 AliReducedEventInputHandler::AliReducedEventInputHandler() :
     AliInputEventHandler(),
     fEventInputOption(kReducedBaseEvent),
+    fActiveTrackColumns(""),
+    fReadCacheSize(0),
     fReducedEvent(0)
 {
   // Default constructor
@@ -24,6 +28,8 @@ AliReducedEventInputHandler::AliReducedEventInputHandler() :
 AliReducedEventInputHandler::AliReducedEventInputHandler(const char* name, const char* title):
   AliInputEventHandler(name, title),
   fEventInputOption(kReducedBaseEvent),
+  fActiveTrackColumns(""),
+  fReadCacheSize(0),
   fReducedEvent(0)
  {
     // Constructor
@@ -46,6 +52,30 @@ Bool_t AliReducedEventInputHandler::Init(TTree* tree, Option_t* opt)
     SwitchOffBranches();
     SwitchOnBranches();
     
+    // read only the requested track columns; the event is written with split level 99,
+    // so each data member of the tracks lives in its own branch "fTracks.<member>"
+    if(fActiveTrackColumns.Length()) {
+       fTree->SetBranchStatus("fTracks.*", 0);
+       TObjArray* columns = fActiveTrackColumns.Tokenize(",");
+       for(Int_t i=0; i<columns->GetEntries(); ++i) {
+          TString column = ((TObjString*)columns->At(i))->GetString().Strip(TString::kBoth);
+          // match the member exactly: a trailing wildcard would also enable the members sharing
+          // the prefix (e.g. fP would switch on fPhi); fixed size arrays are named fTracks.<member>[n]
+          UInt_t nFound = 0, nFoundArray = 0;
+          fTree->SetBranchStatus(Form("fTracks.%s", column.Data()), 1, &nFound);
+          fTree->SetBranchStatus(Form("fTracks.%s[*", column.Data()), 1, &nFoundArray);
+          if(!nFound && !nFoundArray)
+             Warning("Init", "Track column %s not found in the tree", column.Data());
+       }
+       delete columns;
+    }
+    
+    // prefetch the baskets of the active branches, cluster by cluster
+    if(fReadCacheSize>0) {
+       fTree->SetCacheSize(fReadCacheSize);
+       fTree->SetCacheLearnEntries(10);
+    }
+    
     // Get pointer to the event
     if (!fReducedEvent) {
        switch(fEventInputOption) {
@@ -34,15 +34,24 @@ class AliReducedEventInputHandler : public AliInputEventHandler {
                  void                                SetInputEventType(Int_t type) {fEventInputOption = type;} ;
                  Int_t                               GetInputEventType() const {return fEventInputOption;};
                  
+                 // Column selection at read time: only the listed members of the track array are read
+                 // (comma separated, e.g. "fP,fCharge,fQualityFlags"); all the others are switched off
+                 void                                SetActiveTrackColumns(const Char_t* columns) {fActiveTrackColumns = columns;}
+                 const Char_t*                       GetActiveTrackColumns() const {return fActiveTrackColumns.Data();}
+                 // Size of the tree cache, filled only with the branches actually read during the learning phase
+                 void                                SetReadCacheSize(Long64_t size) {fReadCacheSize = size;}
+                 
  private:
     AliReducedEventInputHandler(const AliReducedEventInputHandler& handler);             
     AliReducedEventInputHandler& operator=(const AliReducedEventInputHandler& handler);      
     
     Int_t  fEventInputOption;                          // one of the options listed in EReducedEventInputType
+    TString fActiveTrackColumns;                       // track data members to be read (all if empty)
+    Long64_t fReadCacheSize;                           // tree cache size (0 = ROOT default)
     AliReducedBaseEvent* fReducedEvent;   //! Pointer to the event
     //AliReducedEventInfo* fReducedEvent;   //! Pointer to the event
     
-    ClassDef(AliReducedEventInputHandler, 2);
+    ClassDef(AliReducedEventInputHandler, 3);
 };
 
 #endif
@@ -24,7 +24,11 @@ ClassImp(AliReducedVarCut)
 //____________________________________________________________________________
 AliReducedVarCut::AliReducedVarCut() :
   AliReducedInfoCut(),
-  fNCuts(0)
+  fNCuts(0),
+  fReorderCuts(kFALSE),
+  fReorderPeriod(1000),
+  fNOrderedCuts(0),
+  fNCallsSinceReorder(0)
 {
   //
   // default constructor
@@ -41,13 +45,20 @@ AliReducedVarCut::AliReducedVarCut() :
      fDependentVariableExclude[i] = kFALSE;
      fFuncCutLow[i] = 0x0;
      fFuncCutHigh[i] = 0x0;
+     fCutOrder[i] = i;
+     fNCutTried[i] = 0;
+     fNCutFailed[i] = 0;
   }
 }
 
 //____________________________________________________________________________
 AliReducedVarCut::AliReducedVarCut(const Char_t* name, const Char_t* title) :
   AliReducedInfoCut(name, title),
-  fNCuts(0)
+  fNCuts(0),
+  fReorderCuts(kFALSE),
+  fReorderPeriod(1000),
+  fNOrderedCuts(0),
+  fNCallsSinceReorder(0)
 {
   //
   // named constructor
@@ -64,6 +75,9 @@ AliReducedVarCut::AliReducedVarCut(const Char_t* name, const Char_t* title) :
       fDependentVariableExclude[i] = kFALSE;
       fFuncCutLow[i] = 0x0;
       fFuncCutHigh[i] = 0x0;
+      fCutOrder[i] = i;
+      fNCutTried[i] = 0;
+      fNCutFailed[i] = 0;
    }
 }
 
@@ -217,35 +231,87 @@ Bool_t AliReducedVarCut::IsSelected(TObject* obj) {
 }
 
 
+//____________________________________________________________________________
+Bool_t AliReducedVarCut::PassCut(Int_t i, Float_t* values) {
+   //
+   // apply cut i; cuts with a dependent variable outside their applicability range are passed
+   //
+   if(fCutHasDependentVariable[i]) {
+      Bool_t inRangeDep = (values[fDependentVariable[i]]>=fDependentVariableCutLow[i] && values[fDependentVariable[i]]<=fDependentVariableCutHigh[i]);
+      // do not apply this cut if outside of the applicability range
+      if(!inRangeDep && !fDependentVariableExclude[i]) return kTRUE;
+      if(inRangeDep && fDependentVariableExclude[i]) return kTRUE;
+   }
+   if(fFuncCutLow[i]) fCutLow[i] = fFuncCutLow[i]->Eval(values[fDependentVariable[i]]);
+   if(fFuncCutHigh[i]) fCutHigh[i] = fFuncCutHigh[i]->Eval(values[fDependentVariable[i]]);      
+   Bool_t inRange = (values[fCutVariables[i]]>=fCutLow[i] && values[fCutVariables[i]]<=fCutHigh[i]);
+   if(!inRange && !fCutExclude[i]) return kFALSE;
+   if(inRange && fCutExclude[i]) return kFALSE;
+   return kTRUE;
+}
+
+
 //____________________________________________________________________________
 Bool_t AliReducedVarCut::IsSelected(Float_t* values) {
    //
    // apply cuts
    //         
-   for(Int_t i=0; i<fNCuts; ++i) {
-      //cout << "AliReducedVarCut::IsSelected() icut " << i << endl;
-      if(fCutHasDependentVariable[i]) {
-         //cout << "AliReducedVarCut::IsSelected() has dependent var " << endl;
-         Bool_t inRangeDep = (values[fDependentVariable[i]]>=fDependentVariableCutLow[i] && values[fDependentVariable[i]]<=fDependentVariableCutHigh[i]);
-         //cout << "AliReducedVarCut::IsSelected() inRangeDep/fDepVar/val/cutLow/cutHigh: " << inRangeDep 
-         //        << "/" << fDependentVariable[i] << "/" << values[fDependentVariable[i]] << "/"
-         //        << fDependentVariableCutLow[i] << "/" << fDependentVariableCutHigh[i] << endl;
-         //cout << "AliReducedVarCut::IsSelected() fDependentVariableExclude: " << fDependentVariableExclude[i] << endl;        
-         // do not apply this cut if outside of the applicability range
-         if(!inRangeDep && !fDependentVariableExclude[i]) continue;
-         if(inRangeDep && fDependentVariableExclude[i]) continue;
-      }
-      if(fFuncCutLow[i]) {
-         fCutLow[i] = fFuncCutLow[i]->Eval(values[fDependentVariable[i]]);
-         //cout << "Func low cut depVar/cutVal :: " << values[fDependentVariable[i]] << " / " << fCutLow[i] << endl;
-      }
-      if(fFuncCutHigh[i]) fCutHigh[i] = fFuncCutHigh[i]->Eval(values[fDependentVariable[i]]);      
-      Bool_t inRange = (values[fCutVariables[i]]>=fCutLow[i] && values[fCutVariables[i]]<=fCutHigh[i]);
-      //cout << "AliReducedVarCut::IsSelected() inRange/fCutVariables/val/cutLow/cutHigh: " << inRange << "/" << fCutVariables[i]
-      //        << "/" << values[fCutVariables[i]] << "/" << fCutLow[i] << "/" << fCutHigh[i] << "/" << fCutExclude[i] << endl;
-      if(!inRange && !fCutExclude[i]) return kFALSE;
-      if(inRange && fCutExclude[i]) return kFALSE;
+   if(!fReorderCuts) {
+      for(Int_t i=0; i<fNCuts; ++i)
+         if(!PassCut(i, values)) return kFALSE;
+      return kTRUE;
    }
    
+   // cuts added since the last update are appended in definition order
+   if(fNOrderedCuts!=fNCuts) {
+      for(Int_t i=0; i<fNCuts; ++i) {fCutOrder[i] = i; fNCutTried[i] = 0; fNCutFailed[i] = 0;}
+      fNOrderedCuts = fNCuts;
+      fNCallsSinceReorder = 0;
+   }
+   if(++fNCallsSinceReorder>=fReorderPeriod) ReorderCuts();
+   
+   for(Int_t k=0; k<fNCuts; ++k) {
+      Int_t i = fCutOrder[k];
+      fNCutTried[i]++;
+      if(!PassCut(i, values)) {
+         fNCutFailed[i]++;
+         return kFALSE;
+      }
+   }
    return kTRUE;
 }
+
+
+//____________________________________________________________________________
+void AliReducedVarCut::ReorderCuts() {
+   //
+   // sort the cuts in decreasing order of rejection rate per unit cost; a TF1 evaluation is counted
+   // as 10 simple comparisons. The counters are then halved, such that the order follows changes in the input
+   //
+   Double_t score[kNMaxCuts];
+   for(Int_t i=0; i<fNCuts; ++i) {
+      Double_t cost = 1.0 + (fFuncCutLow[i] ? 10.0 : 0.0) + (fFuncCutHigh[i] ? 10.0 : 0.0);
+      score[i] = (fNCutTried[i]>0 ? Double_t(fNCutFailed[i])/Double_t(fNCutTried[i]) : 1.0) / cost;
+      fNCutTried[i] /= 2; fNCutFailed[i] /= 2;
+   }
+   // stable insertion sort, the number of cuts is small
+   for(Int_t k=1; k<fNCuts; ++k) {
+      Short_t cut = fCutOrder[k];
+      Int_t j = k-1;
+      while(j>=0 && score[fCutOrder[j]]<score[cut]) {fCutOrder[j+1] = fCutOrder[j]; --j;}
+      fCutOrder[j+1] = cut;
+   }
+   fNCallsSinceReorder = 0;
+}
+
+
+//____________________________________________________________________________
+ULong64_t AliReducedVarCut::GetFailedCutsMask(Float_t* values) {
+   //
+   // evaluate all the cuts and return the bit map of the failing ones
+   //
+   ULong64_t mask = 0;
+   for(Int_t i=0; i<fNCuts; ++i)
+      if(!PassCut(i, values)) mask |= (ULong64_t(1)<<(i<63 ? i : 63));
+   return mask;
+}
@@ -39,6 +39,16 @@ class AliReducedVarCut : public AliReducedInfoCut {
   virtual Bool_t IsSelected(Float_t* values);
   virtual Bool_t IsSelected(TObject* obj, Float_t* values);
   
+  // NOTE: Evaluate all the cuts and return a bit map of the failing ones (bit i for cut i, in the order they were added).
+  // NOTE:     Cuts beyond the 63rd all map onto bit 63. Useful for QA; the selection is passed if the map is 0
+  ULong64_t GetFailedCutsMask(Float_t* values);
+  
+  // NOTE: If enabled, the cuts are evaluated in decreasing order of measured rejection power per unit cost
+  // NOTE:     (a cut using a TF1 counts as more expensive). The order is updated every "period" calls.
+  // NOTE:     The selection result does not depend on the order
+  void SetReorderCuts(Bool_t flag=kTRUE, Int_t period=1000) {fReorderCuts = flag; fReorderPeriod = (period>0 ? period : 1000);}
+  Bool_t GetReorderCuts() const {return fReorderCuts;}
+  
  protected: 
   
    Int_t       fNCuts;                                    // number of enabled cuts
@@ -53,11 +63,22 @@ class AliReducedVarCut : public AliReducedInfoCut {
    Bool_t    fDependentVariableExclude[kNMaxCuts];  // if true, then use the dependent variable range as exclusion
    TF1*      fFuncCutLow[kNMaxCuts];     // low cut functions
    TF1*      fFuncCutHigh[kNMaxCuts];    // high cut functions
+   
+   Bool_t    fReorderCuts;                // if true, evaluate the cuts in order of rejection power per unit cost
+   Int_t     fReorderPeriod;              // number of calls between two updates of the cut order
+   Int_t     fNOrderedCuts;               //! number of cuts in fCutOrder
+   Short_t   fCutOrder[kNMaxCuts];        //! order of evaluation of the cuts
+   UInt_t    fNCutTried[kNMaxCuts];       //! number of times each cut was evaluated
+   UInt_t    fNCutFailed[kNMaxCuts];      //! number of times each cut rejected the candidate
+   Int_t     fNCallsSinceReorder;         //! calls since the last update of the cut order
+   
+   Bool_t PassCut(Int_t i, Float_t* values);
+   void   ReorderCuts();
       
   AliReducedVarCut(const AliReducedVarCut &c);
   AliReducedVarCut& operator= (const AliReducedVarCut &c);
   
-  ClassDef(AliReducedVarCut,2);
+  ClassDef(AliReducedVarCut,3);
 };
 
 #endif
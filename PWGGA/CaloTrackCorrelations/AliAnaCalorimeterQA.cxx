@@ -83,6 +83,11 @@ fExoNDTimeCuts(0),                     fExoDTimeCuts(),
 fClusterMomentum(),                    fClusterMomentum2(),
 fPrimaryMomentum(),
 fConstantTimeShift(0),
+fUseCellRunTables(kFALSE),             fCellTablesRun(-1),
+fCellFlag(),                           fCellModule(),
+fCellIndex(),                          fCellPosition(),
+fCellAccSumW(),                        fCellAccSumW2(),
+fCellAccN(),
 // Histograms
 fhE(0),                                fhPt(0),                                
 fhPhi(0),                              fhEta(0),                               
@@ -701,15 +706,41 @@ void AliAnaCalorimeterQA::CellHistograms(AliVCaloCells *cells)
   Float_t  recalF = 1.;  
   Int_t    bc     = GetReader()->GetInputEvent()->GetBunchCrossNumber();
   
+  // Geometry and bad channel status per cell, recomputed for each run
+  if ( fUseCellRunTables )
+  {
+    Int_t run = GetReader()->GetInputEvent()->GetRunNumber();
+    if ( run != fCellTablesRun )
+    {
+      FlushCellAccumulators();
+      fCellFlag.Reset();
+      fCellTablesRun = run;
+    }
+  }
+  
   for (Int_t iCell = 0; iCell < cells->GetNumberOfCells(); iCell++)
   {
     if ( cells->GetCellNumber(iCell) < 0 ) continue; // CPV 
     
     AliDebug(2,Form("Cell : amp %f, absId %d", cells->GetAmplitude(iCell), cells->GetCellNumber(iCell)));
    
-    Int_t nModule = GetModuleNumberCellIndexesAbsCaloMap(cells->GetCellNumber(iCell),GetCalorimeter(), 
-                                                         icol   , irow, iRCU,
-                                                         icolAbs, irowAbs    );
+    Int_t absId   = cells->GetCellNumber(iCell);
+    Int_t nModule = -1;
+    if ( fUseCellRunTables )
+    {
+      if ( absId >= fCellFlag.GetSize() || !(fCellFlag[absId] & kCellTableFilled) ) FillCellRunTable(absId);
+      
+      nModule = fCellModule[absId];
+      icol    = fCellIndex[5*absId  ];
+      irow    = fCellIndex[5*absId+1];
+      iRCU    = fCellIndex[5*absId+2];
+      icolAbs = fCellIndex[5*absId+3];
+      irowAbs = fCellIndex[5*absId+4];
+    }
+    else
+      nModule = GetModuleNumberCellIndexesAbsCaloMap(absId,GetCalorimeter(), 
+                                                     icol   , irow, iRCU,
+                                                     icolAbs, irowAbs    );
     
     AliDebug(2,Form("\t module %d, column %d (%d), row %d (%d)", nModule,icolAbs,icol,irowAbs,irow));
     
@@ -718,7 +749,11 @@ void AliAnaCalorimeterQA::CellHistograms(AliVCaloCells *cells)
       //Check if the cell is a bad channel
       if(GetCaloUtils()->IsBadChannelsRemovalSwitchedOn())
       {
-        if(GetCalorimeter()==kEMCAL)
+        if(fUseCellRunTables)
+        {
+          if(fCellFlag[absId] & kCellTableBad) continue;
+        }
+        else if(GetCalorimeter()==kEMCAL)
         {
           if(GetCaloUtils()->GetEMCALChannelStatus(nModule,icol,irow)) continue;
         }
@@ -793,13 +828,27 @@ void AliAnaCalorimeterQA::CellHistograms(AliVCaloCells *cells)
 
         if(!fStudyWeight) eCellsInModule[nModule]+=amp ;
         
-        fhGridCells ->Fill(icolAbs, irowAbs, GetEventWeight());
-        fhGridCellsE->Fill(icolAbs, irowAbs, amp             );
-        
-        if(!highG)
+        if(fUseCellRunTables)
+        {
+          AccumulateCell(kAccGrid , id, GetEventWeight());
+          AccumulateCell(kAccGridE, id, amp             );
+          
+          if(!highG)
+          {
+            AccumulateCell(kAccGridLowGain , id, GetEventWeight());
+            AccumulateCell(kAccGridELowGain, id, amp             );
+          }
+        }
+        else
         {
-          fhGridCellsLowGain ->Fill(icolAbs, irowAbs, GetEventWeight());
-          fhGridCellsELowGain->Fill(icolAbs, irowAbs, amp             );
+          fhGridCells ->Fill(icolAbs, irowAbs, GetEventWeight());
+          fhGridCellsE->Fill(icolAbs, irowAbs, amp             );
+          
+          if(!highG)
+          {
+            fhGridCellsLowGain ->Fill(icolAbs, irowAbs, GetEventWeight());
+            fhGridCellsELowGain->Fill(icolAbs, irowAbs, amp             );
+          }
         }
         
         if(fFillAllCellTimeHisto)
@@ -818,8 +867,16 @@ void AliAnaCalorimeterQA::CellHistograms(AliVCaloCells *cells)
           Int_t bc = (GetReader()->GetInputEvent()->GetBunchCrossNumber())%4;
           fhTimePerSMPerBC[bc]->Fill(time, nModule, GetEventWeight());
           
-          fhGridCellsTime->Fill(icolAbs, irowAbs, time);
-          if(!highG) fhGridCellsTimeLowGain->Fill(icolAbs, irowAbs, time);
+          if(fUseCellRunTables)
+          {
+            AccumulateCell(kAccGridTime, id, time);
+            if(!highG) AccumulateCell(kAccGridTimeLowGain, id, time);
+          }
+          else
+          {
+            fhGridCellsTime->Fill(icolAbs, irowAbs, time);
+            if(!highG) fhGridCellsTimeLowGain->Fill(icolAbs, irowAbs, time);
+          }
             
           fhTimeMod->Fill(time, nModule, GetEventWeight());
           fhTimeAmpPerRCU[nModule*fNRCU+iRCU]->Fill(amp, time, GetEventWeight());
@@ -833,7 +890,33 @@ void AliAnaCalorimeterQA::CellHistograms(AliVCaloCells *cells)
       }
       
       // Get Eta-Phi position of Cell
-      if(fFillAllPosHisto)
+      if(fFillAllPosHisto && fUseCellRunTables)
+      {
+        if ( !(fCellFlag[id] & kCellTablePosition) ) FillCellRunTable(id);
+        
+        if ( fCellFlag[id] & kCellTablePosition )
+        {
+          const Double_t * cellpos = fCellPosition.GetArray()+5*id;
+          
+          if ( GetCalorimeter() == kEMCAL )
+          {
+            if(fFillAllTH3)
+              fhEtaPhiAmpCell->Fill(cellpos[0], cellpos[1], amp, GetEventWeight());
+            else
+              AccumulateCell(kAccEtaPhi, id, GetEventWeight());
+          }
+          
+          fhXCellE->Fill(cellpos[2], amp, GetEventWeight())  ;
+          fhYCellE->Fill(cellpos[3], amp, GetEventWeight())  ;
+          fhZCellE->Fill(cellpos[4], amp, GetEventWeight())  ;
+          
+          Float_t rcell = TMath::Sqrt(cellpos[2]*cellpos[2]+cellpos[3]*cellpos[3]);
+          fhRCellE ->Fill(rcell, amp, GetEventWeight())  ;
+          
+          fhXYZCell->Fill(cellpos[2], cellpos[3], cellpos[4], GetEventWeight())  ;
+        }
+      }
+      else if(fFillAllPosHisto)
       {
         if ( GetCalorimeter() == kEMCAL && GetCaloUtils()->IsEMCALGeoMatrixSet() )
         {
@@ -908,7 +991,16 @@ void AliAnaCalorimeterQA::CellHistograms(AliVCaloCells *cells)
 
       AliDebug(2,Form("Cell : amp %f, absId %d", cells->GetAmplitude(iCell), cells->GetCellNumber(iCell)));
       
-      Int_t nModule = GetModuleNumberCellIndexes(cells->GetCellNumber(iCell),GetCalorimeter(), icol, irow, iRCU);
+      Int_t nModule = -1;
+      if ( fUseCellRunTables )
+      {
+        // Table already filled in the first loop
+        nModule = fCellModule[cells->GetCellNumber(iCell)];
+        icol    = fCellIndex[5*cells->GetCellNumber(iCell)  ];
+        irow    = fCellIndex[5*cells->GetCellNumber(iCell)+1];
+      }
+      else
+        nModule = GetModuleNumberCellIndexes(cells->GetCellNumber(iCell),GetCalorimeter(), icol, irow, iRCU);
       
       AliDebug(2,Form("\t module %d, column %d, row %d", nModule,icol,irow));
       
@@ -917,7 +1009,11 @@ void AliAnaCalorimeterQA::CellHistograms(AliVCaloCells *cells)
         //Check if the cell is a bad channel
         if(GetCaloUtils()->IsBadChannelsRemovalSwitchedOn())
         {
-          if(GetCalorimeter()==kEMCAL)
+          if(fUseCellRunTables)
+          {
+            if(fCellFlag[cells->GetCellNumber(iCell)] & kCellTableBad) continue;
+          }
+          else if(GetCalorimeter()==kEMCAL)
           {
             if(GetCaloUtils()->GetEMCALChannelStatus(nModule, icol, irow)) continue;
           }
@@ -977,6 +1073,196 @@ void AliAnaCalorimeterQA::CellHistograms(AliVCaloCells *cells)
   delete [] eCellsInModule;
 }
 
+//__________________________________________________________________________
+/// Fill the per run table entries of cell absId: module number, cell indexes,
+/// bad channel status and, once the geometry matrices are available, its
+/// position. Arrays are enlarged on demand to absId+1 cells.
+//__________________________________________________________________________
+void AliAnaCalorimeterQA::FillCellRunTable(Int_t absId)
+{
+  if ( absId >= fCellFlag.GetSize() )
+  {
+    Int_t ncells = absId+1;
+    fCellFlag    .Set(ncells);
+    fCellModule  .Set(ncells);
+    fCellIndex   .Set(5*ncells);
+    fCellPosition.Set(5*ncells);
+    fCellAccSumW .Set(kNCellAcc*ncells);
+    fCellAccSumW2.Set(kNCellAcc*ncells);
+    fCellAccN    .Set(kNCellAcc*ncells);
+  }
+  
+  Int_t * index = fCellIndex.GetArray()+5*absId;
+  
+  if ( !(fCellFlag[absId] & kCellTableFilled) )
+  {
+    Int_t nModule = GetModuleNumberCellIndexesAbsCaloMap(absId, GetCalorimeter(),
+                                                         index[0], index[1], index[2],
+                                                         index[3], index[4]);
+    fCellModule[absId] = nModule;
+    
+    Char_t flag = kCellTableFilled;
+    
+    if ( nModule >= 0 && nModule < fNModules && GetCaloUtils()->IsBadChannelsRemovalSwitchedOn() )
+    {
+      if ( GetCalorimeter() == kEMCAL )
+      {
+        if ( GetCaloUtils()->GetEMCALChannelStatus(nModule, index[0], index[1]) ) flag |= kCellTableBad;
+      }
+      else
+      {
+        if ( GetCaloUtils()->GetPHOSChannelStatus (nModule, index[0], index[1]) ) flag |= kCellTableBad;
+      }
+    }
+    
+    fCellFlag[absId] = flag;
+  }
+  
+  if ( fCellFlag[absId] & kCellTablePosition ) return;
+  
+  // Position, only when the geometry matrices are set, retried otherwise
+  Double_t * pos = fCellPosition.GetArray()+5*absId;
+  
+  if ( GetCalorimeter() == kEMCAL && GetCaloUtils()->IsEMCALGeoMatrixSet() )
+  {
+    Float_t celleta = 0.;
+    Float_t cellphi = 0.;
+    GetEMCALGeometry()->EtaPhiFromIndex(absId, celleta, cellphi);
+    
+    if ( cellphi < 0 ) cellphi+=TMath::TwoPi();
+    
+    Double_t cellpos[] = {0, 0, 0};
+    GetEMCALGeometry()->GetGlobal(absId, cellpos);
+    
+    pos[0] = celleta;
+    pos[1] = cellphi;
+    pos[2] = cellpos[0];
+    pos[3] = cellpos[1];
+    pos[4] = cellpos[2];
+    
+    fCellFlag[absId] |= kCellTablePosition;
+  }
+  else if ( GetCalorimeter() == kPHOS && GetCaloUtils()->IsPHOSGeoMatrixSet() )
+  {
+    TVector3 xyz;
+    Int_t relId[4], module;
+    Float_t xCell, zCell;
+    
+    GetPHOSGeometry()->AbsToRelNumbering(absId,relId);
+    module = relId[0];
+    GetPHOSGeometry()->RelPosInModule(relId,xCell,zCell);
+    GetPHOSGeometry()->Local2Global(module,xCell,zCell,xyz);
+    
+    pos[0] = 0.;
+    pos[1] = 0.;
+    pos[2] = xyz.X();
+    pos[3] = xyz.Y();
+    pos[4] = xyz.Z();
+    
+    fCellFlag[absId] |= kCellTablePosition;
+  }
+}
+
+//__________________________________________________________________________
+/// Move the entries accumulated per cell for one of the cellAccumulator
+/// histograms into the histogram h. Bin contents, errors, entries and
+/// statistics are the same as if each entry had been filled in h directly.
+//__________________________________________________________________________
+void AliAnaCalorimeterQA::FlushCellAccumulator(TH2F * h, Int_t iacc)
+{
+  if ( !h ) return;
+  
+  Int_t ncells = fCellFlag.GetSize();
+  
+  // Fill() creates the errors structure with the first non unit weight
+  if ( h->GetSumw2N() == 0 )
+  {
+    for(Int_t absId = 0; absId < ncells; absId++)
+    {
+      Int_t i = absId*kNCellAcc+iacc;
+      if ( fCellAccN[i] > 0 && (fCellAccSumW[i] != fCellAccN[i] || fCellAccSumW2[i] != fCellAccN[i]) )
+      {
+        h->Sumw2();
+        break;
+      }
+    }
+  }
+  
+  Double_t * sumw2 = h->GetSumw2N() > 0 ? h->GetSumw2()->GetArray() : 0x0;
+  
+  Double_t stats[7];
+  h->GetStats(stats);
+  
+  Int_t    nx      = h->GetNbinsX();
+  Int_t    ny      = h->GetNbinsY();
+  Double_t entries = h->GetEntries();
+  
+  for(Int_t absId = 0; absId < ncells; absId++)
+  {
+    Int_t i = absId*kNCellAcc+iacc;
+    if ( fCellAccN[i] == 0 ) continue;
+    
+    Double_t x = 0, y = 0;
+    if ( iacc == kAccEtaPhi )
+    {
+      x = fCellPosition[5*absId  ];
+      y = fCellPosition[5*absId+1];
+    }
+    else
+    {
+      x = fCellIndex[5*absId+3];
+      y = fCellIndex[5*absId+4];
+    }
+    
+    Int_t binx = h->GetXaxis()->FindBin(x);
+    Int_t biny = h->GetYaxis()->FindBin(y);
+    Int_t bin  = h->GetBin(binx, biny);
+    
+    Double_t w  = fCellAccSumW [i];
+    Double_t w2 = fCellAccSumW2[i];
+    
+    h->AddBinContent(bin, w);
+    if ( sumw2 ) sumw2[bin] += w2;
+    
+    entries += fCellAccN[i];
+    
+    if ( binx >= 1 && binx <= nx && biny >= 1 && biny <= ny )
+    {
+      stats[0] += w;
+      stats[1] += w2;
+      stats[2] += w*x;
+      stats[3] += w*x*x;
+      stats[4] += w*y;
+      stats[5] += w*y*y;
+      stats[6] += w*x*y;
+    }
+    
+    fCellAccSumW [i] = 0;
+    fCellAccSumW2[i] = 0;
+    fCellAccN    [i] = 0;
+  }
+  
+  h->PutStats(stats);
+  h->SetEntries(entries);
+}
+
+//__________________________________________________________________________
+/// Move all the entries accumulated per cell into their histograms.
+/// Called at each run change and at the end of the task on the worker.
+//__________________________________________________________________________
+void AliAnaCalorimeterQA::FlushCellAccumulators()
+{
+  if ( fCellFlag.GetSize() == 0 ) return;
+  
+  FlushCellAccumulator(fhGridCells           , kAccGrid           );
+  FlushCellAccumulator(fhGridCellsE          , kAccGridE          );
+  FlushCellAccumulator(fhGridCellsTime       , kAccGridTime       );
+  FlushCellAccumulator(fhGridCellsLowGain    , kAccGridLowGain    );
+  FlushCellAccumulator(fhGridCellsELowGain   , kAccGridELowGain   );
+  FlushCellAccumulator(fhGridCellsTimeLowGain, kAccGridTimeLowGain);
+  FlushCellAccumulator(fhEtaPhiCell          , kAccEtaPhi         );
+}
+
 //__________________________________________________________________________
 /// Fill histograms releated to cluster cell position.
 //__________________________________________________________________________
@@ -6753,6 +7039,16 @@ void AliAnaCalorimeterQA::Print(const Option_t * opt) const
   printf("Inv. Mass %2.1f < M02_clus < %2.1f GeV/c\n", fInvMassMinM02Cut, fInvMassMaxM02Cut) ;
   printf("Inv. Mass open angle : %2.1f deg\n"        , fInvMassMaxOpenAngle*TMath::RadToDeg()) ;
   printf("Inv. Mass time difference: %2.1f ns\n"     , fInvMassMaxTimeDifference) ;
+  printf("Per run cell tables : %d\n"               , fUseCellRunTables) ;
+}
+
+//_____________________________________________________
+/// Called on the worker once all events are processed,
+/// move the cell maps accumulated per cell into the histograms.
+//_____________________________________________________
+void AliAnaCalorimeterQA::FinishTaskOutput()
+{
+  if ( fUseCellRunTables ) FlushCellAccumulators();
 }
 
 //_____________________________________________________
@@ -29,6 +29,9 @@
 ///_________________________________________________________________________
 
 // --- Root system ---
+#include <TArrayC.h>
+#include <TArrayI.h>
+#include <TArrayD.h>
 class TH3F;
 class TH2F;
 class TH1F;
@@ -63,6 +66,8 @@ public:
     
   void         MakeAnalysisFillHistograms() ;
   
+  void         FinishTaskOutput() ;
+  
   void         Print(const Option_t * opt) const;
     
   // Main methods
@@ -213,6 +218,9 @@ public:
   
   void SetConstantTimeShift(Float_t shift)      { fConstantTimeShift     = shift  ; }
 
+  void SwitchOnCellRunTables()                  { fUseCellRunTables = kTRUE  ; }
+  void SwitchOffCellRunTables()                 { fUseCellRunTables = kFALSE ; }
+  
   
  private:
   
@@ -282,6 +290,34 @@ public:
   TLorentzVector fPrimaryMomentum;              //!<! Primary MC momentum, temporary container
   
   Float_t  fConstantTimeShift;                  ///<  Apply a 600 ns time shift in case of simulation, shift in ns.
+  
+  // Per run cell tables and dense cell histograms
+  
+  /// Content of fCellFlag per absId.
+  enum cellTableFlag { kCellTableFilled = 1, kCellTableBad = 2, kCellTablePosition = 4 } ;
+  
+  /// Histograms with one fixed bin per cell, accumulated in fCellAccSumW.
+  enum cellAccumulator { kAccGrid, kAccGridE, kAccGridTime, kAccGridLowGain, kAccGridELowGain, kAccGridTimeLowGain,
+                         kAccEtaPhi, kNCellAcc } ;
+  
+  void     FillCellRunTable(Int_t absId) ;
+  
+  /// Add one entry with weight w of a cell to an accumulated histogram.
+  void     AccumulateCell(Int_t iacc, Int_t absId, Double_t w)
+  { Int_t i = absId*kNCellAcc+iacc ; fCellAccSumW[i] += w ; fCellAccSumW2[i] += w*w ; fCellAccN[i]++ ; }
+  
+  void     FlushCellAccumulator(TH2F * h, Int_t iacc) ;
+  void     FlushCellAccumulators() ;
+  
+  Bool_t   fUseCellRunTables;                   ///<  Take cell module, indices, bad status and position from per run tables, accumulate the cell maps per cell.
+  Int_t    fCellTablesRun;                      //!<! Run of the cell tables.
+  TArrayC  fCellFlag;                           //!<! Per absId, see cellTableFlag, 0 if not yet computed in this run.
+  TArrayI  fCellModule;                         //!<! Per absId, module number.
+  TArrayI  fCellIndex;                          //!<! Per absId, column, row, RCU, absolute column and row.
+  TArrayD  fCellPosition;                       //!<! Per absId, eta, phi (EMCal), global x, y, z.
+  TArrayD  fCellAccSumW;                        //!<! Per absId and cellAccumulator, sum of weights.
+  TArrayD  fCellAccSumW2;                       //!<! Per absId and cellAccumulator, sum of squared weights.
+  TArrayI  fCellAccN;                           //!<! Per absId and cellAccumulator, number of entries.
 
   
   // Calorimeter Clusters
@@ -833,7 +869,7 @@ public:
   AliAnaCalorimeterQA(              const AliAnaCalorimeterQA & qa) ;
   
   /// \cond CLASSIMP
-  ClassDef(AliAnaCalorimeterQA,36) ;
+  ClassDef(AliAnaCalorimeterQA,37) ;
   /// \endcond
 
 } ;
@@ -52,7 +52,8 @@ ClassImp(AliAnaPi0) ;
 /// Default Constructor. Initialized parameters with default values.
 //______________________________________________________
 AliAnaPi0::AliAnaPi0() : AliAnaCaloTrackCorrBaseClass(),
-fEventsList(0x0),
+fEventsList(),               fCurrentPhotons(),
+fMixPairM(),                 fMixPairPt(),                 fMixPairAsym(),               fMixPairAngle(),
 fNModules(22),
 fUseAngleCut(kFALSE),        fUseAngleEDepCut(kFALSE),     fAngleCut(0),                 fAngleMaxCut(0.),
 fMultiCutAna(kFALSE),        fMultiCutAnaSim(kFALSE),      fMultiCutAnaAcc(kFALSE),
@@ -226,24 +227,7 @@ fhReSecondaryCellOutTimeWindow(0), fhMiSecondaryCellOutTimeWindow(0)
 //_____________________
 AliAnaPi0::~AliAnaPi0()
 {
-  // Remove event containers
-  
-  if(DoOwnMix() && fEventsList)
-  {
-    for(Int_t ic=0; ic<GetNCentrBin(); ic++)
-    {
-      for(Int_t iz=0; iz<GetNZvertBin(); iz++)
-      {
-        for(Int_t irp=0; irp<GetNRPBin(); irp++)
-        {
-          Int_t bin = GetEventMixBin(ic,iz,irp);
-          fEventsList[bin]->Delete() ;
-          delete fEventsList[bin] ;
-        }
-      }
-    }
-    delete[] fEventsList;
-  }
+  // Event containers are deleted with the pools
 }
 
 //______________________________
@@ -785,20 +769,16 @@ TList * AliAnaPi0::GetCreateOutputObjects()
   //
   // Create mixed event containers
   //
-  fEventsList = new TList*[GetNCentrBin()*GetNZvertBin()*GetNRPBin()] ;
+  // The buffer keeps the last GetNMaxEvMix()-1 events of each bin,
+  // the slots are allocated here and reused afterwards
+  Int_t nEvMix = GetNMaxEvMix()-1;
+  if ( nEvMix < 0 ) nEvMix = 0;
   
-  for(Int_t ic=0; ic<GetNCentrBin(); ic++)
-  {
-    for(Int_t iz=0; iz<GetNZvertBin(); iz++)
-    {
-      for(Int_t irp=0; irp<GetNRPBin(); irp++)
-      {
-        Int_t bin = GetEventMixBin(ic,iz,irp);
-        fEventsList[bin] = new TList() ;
-        fEventsList[bin]->SetOwner(kFALSE);
-      }
-    }
-  }
+  fEventsList.clear();
+  fEventsList.resize(GetNCentrBin()*GetNZvertBin()*GetNRPBin());
+  
+  for(UInt_t bin = 0; bin < fEventsList.size(); bin++)
+    fEventsList[bin].fEvents.resize(nEvMix);
   
   // Init the number of modules, set in the class AliCalorimeterUtils
   fNModules = GetCaloUtils()->GetNumberOfSuperModulesUsed();
@@ -4242,62 +4222,93 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
     // Check that the bin exists, if not (bad determination of RP, centrality or vz bin) do nothing
     if(eventbin < 0) return ;
     
-    TList * evMixList=fEventsList[eventbin] ;
-    
-    if(!evMixList)
+    if(eventbin >= (Int_t) fEventsList.size())
     {
       AliWarning(Form("Mix event list not available, bin %d",eventbin));
       return;
     }
     
-    Int_t nMixed = evMixList->GetSize() ;
+    MixedEventPool & evMixList = fEventsList[eventbin] ;
+    
+    // Kinematics and flags of the photons of this event in the first loop,
+    // only those within the pT range are kept
+    FillMixedPhotons(GetInputAODBranch(), fCurrentPhotons);
+    const MixedPhotons & phot1 = fCurrentPhotons;
+    
+    Int_t nMixed = evMixList.fNEvents ;
     for(Int_t ii=0; ii<nMixed; ii++)
     {
-      TClonesArray* ev2= (TClonesArray*) (evMixList->At(ii));
-      Int_t nPhot2=ev2->GetEntriesFast() ;
+      const MixedPhotons & phot2 = evMixList.GetEvent(ii);
+      Int_t nPhot2 = phot2.fN ;
       Double_t m = -999;
       AliDebug(1,Form("Mixed event %d photon entries %d, centrality bin %d",ii, nPhot2, GetEventCentralityBin()));
       
       fhEventMixBin->Fill(eventbin, GetEventWeight()) ;
       
+      if((Int_t) fMixPairM.size() < nPhot2)
+      {
+        fMixPairM    .resize(nPhot2);
+        fMixPairPt   .resize(nPhot2);
+        fMixPairAsym .resize(nPhot2);
+        fMixPairAngle.resize(nPhot2);
+      }
+      
       //---------------------------------
       // First loop on photons/clusters
       //---------------------------------
-      for(Int_t i1 = 0; i1 < nPhot; i1++)
+      for(Int_t i1 = 0; i1 < phot1.fN; i1++)
       {
-        AliAODPWG4Particle * p1 = (AliAODPWG4Particle*) (GetInputAODBranch()->At(i1)) ;
-        
-        // Select photons within a pT range
-        if ( p1->Pt() < GetMinPt() || p1->Pt()  > GetMaxPt() ) continue ;
-        
-        // Not sure why this line is here
-        //if(fSameSM && GetModuleNumber(p1)!=module1) continue;
-        
         //Get kinematics of cluster and (super) module of this cluster
-        fPhotonMom1.SetPxPyPzE(p1->Px(),p1->Py(),p1->Pz(),p1->E());
-        module1 = GetModuleNumber(p1);
+        Double_t px1 = phot1.fPx[i1];
+        Double_t py1 = phot1.fPy[i1];
+        Double_t pz1 = phot1.fPz[i1];
+        Double_t e1  = phot1.fE [i1];
+        fPhotonMom1.SetPxPyPzE(px1,py1,pz1,e1);
+        module1 = phot1.fModule[i1];
         
         //---------------------------------
-        // Second loop on other mixed event photons/clusters
+        // Pair mass, pT, asymmetry and opening angle with all the photons
+        // of the mixed event, same arithmetic as with TLorentzVector
         //---------------------------------
+        Double_t p1Mag2 = px1*px1 + py1*py1 + pz1*pz1;
         for(Int_t i2 = 0; i2 < nPhot2; i2++)
         {
-          AliAODPWG4Particle * p2 = (AliAODPWG4Particle*) (ev2->At(i2)) ;
+          Double_t px2 = phot2.fPx[i2];
+          Double_t py2 = phot2.fPy[i2];
+          Double_t pz2 = phot2.fPz[i2];
+          Double_t e2  = phot2.fE [i2];
           
-          // Select photons within a pT range
-          if ( p2->Pt() < GetMinPt() || p2->Pt()  > GetMaxPt() ) continue ;
+          Double_t px = px1+px2;
+          Double_t py = py1+py2;
+          Double_t pz = pz1+pz2;
+          Double_t e  = e1 +e2 ;
+          Double_t m2 = e*e - (px*px + py*py + pz*pz);
+          fMixPairM   [i2] = m2 < 0 ? -TMath::Sqrt(-m2) : TMath::Sqrt(m2);
+          fMixPairPt  [i2] = TMath::Sqrt(px*px + py*py);
+          fMixPairAsym[i2] = TMath::Abs(e1-e2)/(e1+e2);
           
-          // Get kinematics of second cluster and calculate those of the pair
-          fPhotonMom2.SetPxPyPzE(p2->Px(),p2->Py(),p2->Pz(),p2->E());
-          m           = (fPhotonMom1+fPhotonMom2).M() ;
-          Double_t pt = (fPhotonMom1 + fPhotonMom2).Pt();
-          Double_t a  = TMath::Abs(p1->E()-p2->E())/(p1->E()+p2->E()) ;
+          Double_t ptot2 = p1Mag2 * (px2*px2 + py2*py2 + pz2*pz2);
+          Double_t arg   = 1.;
+          if(ptot2 > 0) arg = (px1*px2 + py1*py2 + pz1*pz2)/TMath::Sqrt(ptot2);
+          if(arg >  1.) arg =  1.;
+          if(arg < -1.) arg = -1.;
+          fMixPairAngle[i2] = TMath::ACos(arg);
+        }
+        
+        //---------------------------------
+        // Second loop on other mixed event photons/clusters
+        //---------------------------------
+        for(Int_t i2 = 0; i2 < nPhot2; i2++)
+        {
+          m           = fMixPairM   [i2] ;
+          Double_t pt = fMixPairPt  [i2] ;
+          Double_t a  = fMixPairAsym[i2] ;
           
           // Check if opening angle is too large or too small compared to what is expected
-          Double_t angle   = fPhotonMom1.Angle(fPhotonMom2.Vect());
-          if(fUseAngleEDepCut && !GetNeutralMesonSelection()->IsAngleInWindow((fPhotonMom1+fPhotonMom2).E(),angle+0.05))
+          Double_t angle   = fMixPairAngle[i2];
+          if(fUseAngleEDepCut && !GetNeutralMesonSelection()->IsAngleInWindow(e1+phot2.fE[i2],angle+0.05))
           {
-            AliDebug(2,Form("Mix pair angle %f (deg) not in E %f window",RadToDeg(angle), (fPhotonMom1+fPhotonMom2).E()));
+            AliDebug(2,Form("Mix pair angle %f (deg) not in E %f window",RadToDeg(angle), e1+phot2.fE[i2]));
             continue;
           }
           
@@ -4307,10 +4318,13 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
             continue;
           }
           
-          AliDebug(2,Form("Mixed Event: pT: fPhotonMom1 %2.2f, fPhotonMom2 %2.2f; Pair: pT %2.2f, mass %2.3f, a %2.3f",p1->Pt(), p2->Pt(), pt,m,a));
+          AliDebug(2,Form("Mixed Event: pT: fPhotonMom1 %2.2f, fPhotonMom2 %2.2f; Pair: pT %2.2f, mass %2.3f, a %2.3f",phot1.fPt[i1], phot2.fPt[i2], pt,m,a));
+          
+          // Get kinematics of second cluster
+          fPhotonMom2.SetPxPyPzE(phot2.fPx[i2],phot2.fPy[i2],phot2.fPz[i2],phot2.fE[i2]);
           
           // In case we want only pairs in same (super) module, check their origin.
-          module2 = GetModuleNumber(p2);
+          module2 = phot2.fModule[i2];
                     
           //-------------------------------------------------------------------------------------------------
           // Fill module dependent histograms, put a cut on assymmetry on the first available cut in the array
@@ -4353,8 +4367,8 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
               Float_t phi1 = GetPhi(fPhotonMom1.Phi());
               Float_t phi2 = GetPhi(fPhotonMom2.Phi());
               Bool_t etaside = 0;
-              if(   (p1->GetDetectorTag()==kEMCAL && fPhotonMom1.Eta() < 0) 
-                 || (p2->GetDetectorTag()==kEMCAL && fPhotonMom2.Eta() < 0)) etaside = 1;
+              if(   (phot1.fDetector[i1]==kEMCAL && fPhotonMom1.Eta() < 0) 
+                 || (phot2.fDetector[i2]==kEMCAL && fPhotonMom2.Eta() < 0)) etaside = 1;
               
               if      (    phi1 > DegToRad(260) && phi2 > DegToRad(260) && phi1 < DegToRad(280) && phi2 < DegToRad(280))  fhMiSameSectorDCALPHOSMod[0+etaside]->Fill(pt, m, GetEventWeight());
               else if (    phi1 > DegToRad(280) && phi2 > DegToRad(280) && phi1 < DegToRad(300) && phi2 < DegToRad(300))  fhMiSameSectorDCALPHOSMod[2+etaside]->Fill(pt, m, GetEventWeight());
@@ -4396,17 +4410,18 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
           // Check if one of the clusters comes from a conversion
           if(fCheckConversion)
           {
-            if     (p1->IsTagged() && p2->IsTagged()) fhMiConv2->Fill(pt, m, GetEventWeight());
-            else if(p1->IsTagged() || p2->IsTagged()) fhMiConv ->Fill(pt, m, GetEventWeight());
+            if     (phot1.fTagged[i1] && phot2.fTagged[i2]) fhMiConv2->Fill(pt, m, GetEventWeight());
+            else if(phot1.fTagged[i1] || phot2.fTagged[i2]) fhMiConv ->Fill(pt, m, GetEventWeight());
           }
           
           //
           // Main invariant mass histograms
           // Fill histograms for different bad channel distance, centrality, assymmetry cut and pid bit
           //
+          Int_t pidBits = phot1.fPIDBits[i1] & phot2.fPIDBits[i2];
           for(Int_t ipid=0; ipid<fNPIDBits; ipid++)
           {
-            if((p1->IsPIDOK(ipid,AliCaloPID::kPhoton)) && (p2->IsPIDOK(ipid,AliCaloPID::kPhoton)))
+            if(pidBits & (1<<ipid))
             {
               for(Int_t iasym=0; iasym < fNAsymCuts; iasym++)
               {
@@ -4421,12 +4436,12 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
                   
                   if(fFillBadDistHisto)
                   {
-                    if(p1->DistToBad()>0 && p2->DistToBad()>0)
+                    if(phot1.fDistToBad[i1]>0 && phot2.fDistToBad[i2]>0)
                     {
                       fhMi2[index]->Fill(pt, m, GetEventWeight()) ;
                       if(fMakeInvPtPlots)fhMiInvPt2[index]->Fill(pt, m, 1./pt * GetEventWeight()) ;
                       
-                      if(p1->DistToBad()>1 && p2->DistToBad()>1)
+                      if(phot1.fDistToBad[i1]>1 && phot2.fDistToBad[i2]>1)
                       {
                         fhMi3[index]->Fill(pt, m, GetEventWeight()) ;
                         if(fMakeInvPtPlots)fhMiInvPt3[index]->Fill(pt, m, 1./pt * GetEventWeight()) ;
@@ -4442,8 +4457,8 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
           //-----------------------
           // Multi cuts analysis
           //-----------------------
-          Int_t  ncell1 = p1->GetNCells();
-          Int_t  ncell2 = p1->GetNCells();
+          Int_t  ncell1 = phot1.fNCells[i1];
+          Int_t  ncell2 = phot1.fNCells[i1];
           
           if(fMultiCutAna)
           {
@@ -4456,8 +4471,8 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
                 {
                   Int_t index = ((ipt*fNCellNCuts)+icell)*fNAsymCuts + iasym;
                   
-                  if(p1->Pt() >   fPtCuts[ipt]      && p2->Pt() > fPtCuts[ipt]      &&
-                     p1->Pt() <   fPtCutsMax[ipt]   && p2->Pt() < fPtCutsMax[ipt]   &&
+                  if(phot1.fPt[i1] > fPtCuts[ipt]    && phot2.fPt[i2] > fPtCuts[ipt]    &&
+                     phot1.fPt[i1] < fPtCutsMax[ipt] && phot2.fPt[i2] < fPtCutsMax[ipt] &&
                      a        <   fAsymCuts[iasym]                                  &&
                      ncell1   >=  fCellNCuts[icell] && ncell2   >= fCellNCuts[icell] 
                      )
@@ -4499,8 +4514,8 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
               Float_t e1   = fPhotonMom1.E();
               Float_t e2   = fPhotonMom2.E();
               
-              Float_t t1   = p1->GetTime();
-              Float_t t2   = p2->GetTime();
+              Float_t t1   = phot1.fTime[i1];
+              Float_t t2   = phot2.fTime[i2];
               
               Int_t nc1    = ncell1;
               Int_t nc2    = ncell2;
@@ -4528,8 +4543,8 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
                 e1   = fPhotonMom2.E();
                 e2   = fPhotonMom1.E();
                 
-                t1   = p2->GetTime();
-                t2   = p1->GetTime();
+                t1   = phot2.fTime[i2];
+                t2   = phot1.fTime[i1];
                 
                 nc1  = ncell2;
                 nc2  = ncell1;
@@ -4589,10 +4604,10 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
           // Check cell time content in cluster
           if ( fFillSecondaryCellTiming )
           {
-            if      ( p1->GetFiducialArea() == 0 && p2->GetFiducialArea() == 0 )
+            if      ( phot1.fFiducial[i1] == 0 && phot2.fFiducial[i2] == 0 )
               fhMiSecondaryCellInTimeWindow ->Fill(pt, m, GetEventWeight());
             
-            else if ( p1->GetFiducialArea() != 0 && p2->GetFiducialArea() != 0 )
+            else if ( phot1.fFiducial[i1] != 0 && phot2.fFiducial[i2] != 0 )
               fhMiSecondaryCellOutTimeWindow->Fill(pt, m, GetEventWeight());
           }
                   
@@ -4604,31 +4619,112 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
     // Add the current event to the list of events for mixing
     //--------------------------------------------------------
     
-    //TClonesArray *currentEvent = new TClonesArray(*GetInputAODBranch());
-    TClonesArray *currentEvent = new TClonesArray(*secondLoopInputData);
-    
-    // Add current event to buffer and Remove redundant events
-    if( currentEvent->GetEntriesFast() > 0 )
+    // Add current event to buffer in place of the oldest one
+    Int_t nSlots = evMixList.fEvents.size();
+    if( secondLoopInputData->GetEntriesFast() > 0 && nSlots > 0 )
     {
-      evMixList->AddFirst(currentEvent) ;
-      currentEvent=0 ; //Now list of particles belongs to buffer and it will be deleted with buffer
-      if( evMixList->GetSize() >= GetNMaxEvMix() )
-      {
-        TClonesArray * tmp = (TClonesArray*) (evMixList->Last()) ;
-        evMixList->RemoveLast() ;
-        delete tmp ;
-      }
-    }
-    else
-    { // empty event
-      delete currentEvent ;
-      currentEvent=0 ;
+      evMixList.fHead = (evMixList.fHead + 1) % nSlots ;
+      MixedPhotons & slot = evMixList.fEvents[evMixList.fHead] ;
+      
+      // Same photons as in the first loop, exchange the buffers instead of copying
+      if ( !fPairWithOtherDetector ) slot.Swap(fCurrentPhotons);
+      else                           FillMixedPhotons(secondLoopInputData, slot);
+      
+      if( evMixList.fNEvents < nSlots ) evMixList.fNEvents++;
     }
   }// DoOwnMix
   
   AliDebug(1,"End fill histograms");
 }
 
+//________________________________________________________________________
+/// Grow the photon columns to hold at least n entries, never shrink them.
+//________________________________________________________________________
+void AliAnaPi0::MixedPhotons::Resize(Int_t n)
+{
+  if ( (Int_t) fPx.size() >= n ) return ;
+  
+  fPx       .resize(n);
+  fPy       .resize(n);
+  fPz       .resize(n);
+  fE        .resize(n);
+  fPt       .resize(n);
+  fTime     .resize(n);
+  fModule   .resize(n);
+  fNCells   .resize(n);
+  fPIDBits  .resize(n);
+  fDistToBad.resize(n);
+  fFiducial .resize(n);
+  fDetector .resize(n);
+  fTagged   .resize(n);
+}
+
+//________________________________________________________________________
+/// Exchange the content, and the allocated buffers, with other photons.
+//________________________________________________________________________
+void AliAnaPi0::MixedPhotons::Swap(MixedPhotons & other)
+{
+  Int_t n = fN; fN = other.fN; other.fN = n;
+  
+  fPx       .swap(other.fPx);
+  fPy       .swap(other.fPy);
+  fPz       .swap(other.fPz);
+  fE        .swap(other.fE);
+  fPt       .swap(other.fPt);
+  fTime     .swap(other.fTime);
+  fModule   .swap(other.fModule);
+  fNCells   .swap(other.fNCells);
+  fPIDBits  .swap(other.fPIDBits);
+  fDistToBad.swap(other.fDistToBad);
+  fFiducial .swap(other.fFiducial);
+  fDetector .swap(other.fDetector);
+  fTagged   .swap(other.fTagged);
+}
+
+//________________________________________________________________________
+/// Store in columns the kinematics and the flags used in the mixed event
+/// pairing of the photons in the array within the analysis pT range.
+/// The module number and the PID bits are computed once per photon here
+/// instead of once per mixed pair.
+//________________________________________________________________________
+void AliAnaPi0::FillMixedPhotons(TClonesArray * array, MixedPhotons & photons)
+{
+  Int_t nPhot = array->GetEntriesFast();
+  photons.Resize(nPhot);
+  
+  Int_t n = 0;
+  for(Int_t i = 0; i < nPhot; i++)
+  {
+    AliAODPWG4Particle * p = (AliAODPWG4Particle*) (array->At(i)) ;
+    
+    // Select photons within a pT range
+    if ( p->Pt() < GetMinPt() || p->Pt()  > GetMaxPt() ) continue ;
+    
+    Int_t pidBits = 0;
+    for(Int_t ipid = 0; ipid < fNPIDBits; ipid++)
+    {
+      if ( p->IsPIDOK(ipid,AliCaloPID::kPhoton) ) pidBits |= (1<<ipid);
+    }
+    
+    photons.fPx       [n] = p->Px();
+    photons.fPy       [n] = p->Py();
+    photons.fPz       [n] = p->Pz();
+    photons.fE        [n] = p->E();
+    photons.fPt       [n] = p->Pt();
+    photons.fTime     [n] = p->GetTime();
+    photons.fModule   [n] = GetModuleNumber(p);
+    photons.fNCells   [n] = p->GetNCells();
+    photons.fPIDBits  [n] = pidBits;
+    photons.fDistToBad[n] = p->DistToBad();
+    photons.fFiducial [n] = p->GetFiducialArea();
+    photons.fDetector [n] = p->GetDetectorTag();
+    photons.fTagged   [n] = p->IsTagged();
+    n++;
+  }
+  
+  photons.fN = n;
+}
+
 //________________________________________________________________________
 /// It retieves the event index and checks the vertex
 ///  * in the mixed buffer returns -2 if vertex NOK
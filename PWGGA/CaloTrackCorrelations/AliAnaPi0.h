@@ -29,8 +29,12 @@ class TH3F ;
 class TH2F ;
 class TObjString;
 
+// C++
+#include <vector>
+
 // Analysis
 #include "AliAnaCaloTrackCorrBaseClass.h"
+class TClonesArray;
 class AliAODEvent ;
 class AliESDEvent ;
 class AliAODPWG4Particle ;
@@ -181,8 +185,60 @@ class AliAnaPi0 : public AliAnaCaloTrackCorrBaseClass {
 
   private:
 
+  /// \struct MixedPhotons
+  /// \brief Kinematics and flags of the photons of one event, stored column-wise.
+  ///
+  /// Only the photons within the analysis pT range are kept. The buffers are
+  /// resized per event but never shrunk, so that a pool slot is reused
+  /// without new allocations once it reached the typical event size.
+  struct MixedPhotons
+  {
+    MixedPhotons() : fN(0), fPx(), fPy(), fPz(), fE(), fPt(), fTime(),
+                     fModule(), fNCells(), fPIDBits(), fDistToBad(), fFiducial(), fDetector(), fTagged() { ; }
+
+    void Resize(Int_t n) ;
+    void Swap(MixedPhotons & other) ;
+
+    Int_t                 fN ;         ///< Number of stored photons.
+    std::vector<Double_t> fPx ;        ///< Momentum x.
+    std::vector<Double_t> fPy ;        ///< Momentum y.
+    std::vector<Double_t> fPz ;        ///< Momentum z.
+    std::vector<Double_t> fE ;         ///< Energy.
+    std::vector<Double_t> fPt ;        ///< Transverse momentum.
+    std::vector<Float_t>  fTime ;      ///< Cluster time.
+    std::vector<Int_t>    fModule ;    ///< (Super) module number.
+    std::vector<Int_t>    fNCells ;    ///< Number of cells in cluster.
+    std::vector<Int_t>    fPIDBits ;   ///< Bit ipid set if IsPIDOK(ipid,kPhoton), ipid < fNPIDBits.
+    std::vector<Int_t>    fDistToBad ; ///< Distance to bad channel.
+    std::vector<Int_t>    fFiducial ;  ///< Fiducial area (secondary cell timing).
+    std::vector<Int_t>    fDetector ;  ///< Detector tag.
+    std::vector<Char_t>   fTagged ;    ///< Tagged as conversion.
+  } ;
+
+  /// \struct MixedEventPool
+  /// \brief Circular buffer of the photons of the last GetNMaxEvMix()-1 events in a mixing bin.
+  struct MixedEventPool
+  {
+    MixedEventPool() : fHead(-1), fNEvents(0), fEvents() { ; }
+
+    /// \return the ii-th most recent event, ii < fNEvents.
+    MixedPhotons & GetEvent(Int_t ii) { Int_t n = fEvents.size() ; return fEvents[(fHead - ii + n) % n] ; }
+
+    Int_t                     fHead ;    ///< Slot of the most recent event.
+    Int_t                     fNEvents ; ///< Number of stored events.
+    std::vector<MixedPhotons> fEvents ;  ///< Event slots, preallocated.
+  } ;
+
+  void     FillMixedPhotons(TClonesArray * array, MixedPhotons & photons) ;
+
   /// Containers for photons in stored events
-  TList ** fEventsList ;               //![GetNCentrBin()*GetNZvertBin()*GetNRPBin()]
+  std::vector<MixedEventPool> fEventsList ; //!<! [GetNCentrBin()*GetNZvertBin()*GetNRPBin()]
+
+  MixedPhotons          fCurrentPhotons ;   //!<! Photons of the current event, first loop of mixing.
+  std::vector<Double_t> fMixPairM ;         //!<! Invariant mass of the pairs of a photon with a mixed event.
+  std::vector<Double_t> fMixPairPt ;        //!<! pT of the pairs of a photon with a mixed event.
+  std::vector<Double_t> fMixPairAsym ;      //!<! Energy asymmetry of the pairs of a photon with a mixed event.
+  std::vector<Double_t> fMixPairAngle ;     //!<! Opening angle of the pairs of a photon with a mixed event.
 
   Int_t    fNModules ;                 ///<  Number of EMCAL/PHOS modules, set as many histogras as modules 
   
@@ -597,7 +653,7 @@ class AliAnaPi0 : public AliAnaCaloTrackCorrBaseClass {
   AliAnaPi0 & operator = (const AliAnaPi0 & api0) ;
   
   /// \cond CLASSIMP
-  ClassDef(AliAnaPi0,35) ;
+  ClassDef(AliAnaPi0,36) ;
   /// \endcond
   
 } ;
@@ -355,6 +355,9 @@ AliAnalysisTaskGammaConvCalo::AliAnalysisTaskGammaConvCalo(): AliAnalysisTaskSE(
   fEnableSortForClusMC(kFALSE),
   fDoPrimaryTrackMatching(kFALSE),
   fDoInvMassShowerShapeTree(kFALSE),
+  fSharePhotonSelection(kFALSE),
+  fPhotonCutGroup(NULL),
+  fPhotonSelectionStage(),
   tBrokenFiles(NULL),
   fFileNameBroken(NULL)
 {
@@ -656,6 +659,9 @@ AliAnalysisTaskGammaConvCalo::AliAnalysisTaskGammaConvCalo(const char *name):
   fEnableSortForClusMC(kFALSE),
   fDoPrimaryTrackMatching(kFALSE),
   fDoInvMassShowerShapeTree(kFALSE),
+  fSharePhotonSelection(kFALSE),
+  fPhotonCutGroup(NULL),
+  fPhotonSelectionStage(),
   tBrokenFiles(NULL),
   fFileNameBroken(NULL)
 {
@@ -689,6 +695,10 @@ AliAnalysisTaskGammaConvCalo::~AliAnalysisTaskGammaConvCalo()
     delete[] fBGClusHandlerRP;
     fBGClusHandlerRP = 0x0;
   }
+  if(fPhotonCutGroup){
+    delete[] fPhotonCutGroup;
+    fPhotonCutGroup = 0x0;
+  }
 }
 //___________________________________________________________
 void AliAnalysisTaskGammaConvCalo::InitBack(){
@@ -804,6 +814,26 @@ void AliAnalysisTaskGammaConvCalo::UserCreateOutputObjects(){
   fGammaCandidates    = new TList();
   fClusterCandidates  = new TList();
   fClusterCandidates->SetOwner(kTRUE);
+
+  // Group cut configurations with identical photon cuts, which then share the photon selection
+  if(fSharePhotonSelection){
+    fPhotonCutGroup     = new Int_t[fnCuts];
+    Int_t nShared       = 0;
+    for(Int_t iCut = 0; iCut<fnCuts;iCut++){
+      fPhotonCutGroup[iCut] = iCut;
+      for(Int_t jCut = 0; jCut<iCut;jCut++){
+        if(((AliConversionPhotonCuts*)fCutArray->At(iCut))->HasSamePhotonSelection((AliConversionPhotonCuts*)fCutArray->At(jCut))){
+          fPhotonCutGroup[iCut] = fPhotonCutGroup[jCut];
+          nShared++;
+          break;
+        }
+      }
+    }
+    if(nShared == 0){
+      delete[] fPhotonCutGroup;
+      fPhotonCutGroup   = NULL;
+    }
+  }
   
   fCutFolder          = new TList*[fnCuts];
   fESDList            = new TList*[fnCuts];
@@ -2336,6 +2366,7 @@ void AliAnalysisTaskGammaConvCalo::UserExec(Option_t *)
   }
   
   fReaderGammas = fV0Reader->GetReconstructedGammas(); // Gammas from default Cut
+  if(fPhotonCutGroup) fPhotonSelectionStage.assign(fnCuts*fReaderGammas->GetEntriesFast(),-1);
 
   // ------------------- BeginEvent ----------------------------
   AliEventplane *EventPlane = fInputEvent->GetEventplane();
@@ -2923,6 +2954,24 @@ void AliAnalysisTaskGammaConvCalo::ProcessTrueClusterCandidatesAOD(AliAODConvers
   return;
 }
 
+//________________________________________________________________________
+Bool_t AliAnalysisTaskGammaConvCalo::PhotonIsSelectedShared(AliAODConversionPhoton *photon, Int_t iPhoton)
+{
+  // PhotonIsSelected for the current cut, evaluated only once per event and photon for all cut
+  // configurations with identical photon cuts (see AliAnalysisTaskGammaConvV1::PhotonIsSelectedShared)
+  AliConversionPhotonCuts *photonCuts = (AliConversionPhotonCuts*)fCutArray->At(fiCut);
+  if(!fPhotonCutGroup) return photonCuts->PhotonIsSelected(photon,fInputEvent);
+
+  Char_t &stage = fPhotonSelectionStage[fPhotonCutGroup[fiCut]*fReaderGammas->GetEntriesFast()+iPhoton];
+  if(stage < 0){
+    photonCuts->PhotonIsSelected(photon,fInputEvent);
+    stage = photonCuts->GetLastPhotonCutStage();
+  } else {
+    photonCuts->FillPhotonCutIndexFromStage(stage);
+  }
+  return stage == AliConversionPhotonCuts::kPhotonOut;
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskGammaConvCalo::ProcessPhotonCandidates()
 {
@@ -2942,7 +2991,7 @@ void AliAnalysisTaskGammaConvCalo::ProcessPhotonCandidates()
       if( (isNegFromMBHeader+isPosFromMBHeader) != 4) fIsFromMBHeader = kFALSE;
     }
     
-    if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->PhotonIsSelected(PhotonCandidate,fInputEvent)) continue;
+    if(!PhotonIsSelectedShared(PhotonCandidate,i)) continue;
     if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->InPlaneOutOfPlaneCut(PhotonCandidate->GetPhotonPhi(),fEventPlaneAngle)) continue;
     if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->UseElecSharingCut() &&
     !((AliConversionPhotonCuts*)fCutArray->At(fiCut))->UseToCloseV0sCut()){
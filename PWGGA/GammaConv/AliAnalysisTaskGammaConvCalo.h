@@ -40,6 +40,7 @@ class AliAnalysisTaskGammaConvCalo : public AliAnalysisTaskSE {
     // base functions for selecting photon and meson candidates in reconstructed data
     void ProcessClusters();
     void ProcessPhotonCandidates();
+    Bool_t PhotonIsSelectedShared(AliAODConversionPhoton *photon, Int_t iPhoton);
     void CalculatePi0Candidates();
     
     // MC functions
@@ -75,6 +76,7 @@ class AliAnalysisTaskGammaConvCalo : public AliAnalysisTaskSE {
     void SetPlotHistsExtQA              ( Bool_t flag )                                     { fSetPlotHistsExtQA = flag                   ;}
     void SetDoTreeConvGammaShowerShape  ( Bool_t flag )                                     { fDoConvGammaShowerShapeTree = flag          ;}
     void SetDoTreeInvMassShowerShape    ( Bool_t flag )                                     { fDoInvMassShowerShapeTree = flag            ;}
+    void SetSharePhotonSelection        ( Bool_t flag )                                     { fSharePhotonSelection = flag                ;}
 
 
     // Setting the cut lists for the conversion photons
@@ -470,6 +472,9 @@ class AliAnalysisTaskGammaConvCalo : public AliAnalysisTaskSE {
     Bool_t                  fEnableSortForClusMC;                               // switch on sorting for MC labels in cluster
     Bool_t                  fDoPrimaryTrackMatching;                            // switch for basic track matching for primaries
     Bool_t                  fDoInvMassShowerShapeTree;                          // flag for producing tree tESDInvMassShowerShape
+    Bool_t                  fSharePhotonSelection;                              // evaluate the photon selection once per photon for all cut configurations with the same photon cuts
+    Int_t*                  fPhotonCutGroup;                                    //! [fnCuts] first cut configuration with the same photon cuts
+    std::vector<Char_t>     fPhotonSelectionStage;                              //! per event: photon selection outcome per photon cut group and photon, -1 if not yet evaluated
     TTree*                  tBrokenFiles;                                       // tree for keeping track of broken files
     TObjString*             fFileNameBroken;                                    // string object for broken file name
     
@@ -478,7 +483,7 @@ class AliAnalysisTaskGammaConvCalo : public AliAnalysisTaskSE {
     AliAnalysisTaskGammaConvCalo(const AliAnalysisTaskGammaConvCalo&); // Prevent copy-construction
     AliAnalysisTaskGammaConvCalo &operator=(const AliAnalysisTaskGammaConvCalo&); // Prevent assignment
 
-    ClassDef(AliAnalysisTaskGammaConvCalo, 39);
+    ClassDef(AliAnalysisTaskGammaConvCalo, 40);
 };
 
 #endif
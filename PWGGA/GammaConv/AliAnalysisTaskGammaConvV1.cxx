@@ -263,6 +263,10 @@ AliAnalysisTaskGammaConvV1::AliAnalysisTaskGammaConvV1(): AliAnalysisTaskSE(),
   fWeightJetJetMC(1),
   fEnableClusterCutsForTrigger(kFALSE),
   fDoMaterialBudgetWeightingOfGammasForTrueMesons(kFALSE),
+  fSharePhotonSelection(kFALSE),
+  fPhotonCutGroup(NULL),
+  fPhotonSelectionStage(),
+  fUseCompactBGPool(kFALSE),
   tBrokenFiles(NULL),
   fFileNameBroken(NULL)
 {
@@ -473,6 +477,10 @@ AliAnalysisTaskGammaConvV1::AliAnalysisTaskGammaConvV1(const char *name):
   fWeightJetJetMC(1),
   fEnableClusterCutsForTrigger(kFALSE),
   fDoMaterialBudgetWeightingOfGammasForTrueMesons(kFALSE),
+  fSharePhotonSelection(kFALSE),
+  fPhotonCutGroup(NULL),
+  fPhotonSelectionStage(),
+  fUseCompactBGPool(kFALSE),
   tBrokenFiles(NULL),
   fFileNameBroken(NULL)
 {
@@ -499,6 +507,10 @@ AliAnalysisTaskGammaConvV1::~AliAnalysisTaskGammaConvV1()
     delete[] fWeightCentrality; 
     fWeightCentrality = 0x0; 
   }
+  if(fPhotonCutGroup){
+    delete[] fPhotonCutGroup;
+    fPhotonCutGroup = 0x0;
+  }
     
 }
 //___________________________________________________________
@@ -575,6 +587,7 @@ void AliAnalysisTaskGammaConvV1::InitBack(){
                                   ((AliConversionMesonCuts*)fMesonCutArray->At(iCut))->GetNumberOfBGEvents(),
                                   ((AliConversionMesonCuts*)fMesonCutArray->At(iCut))->UseTrackMultiplicity(),
                                   0,8,5);
+        if(fUseCompactBGPool) fBGHandler[iCut]->SetUseCompactPool(kTRUE);
         fBGHandlerRP[iCut] = NULL;
       } else {
         fBGHandlerRP[iCut] = new AliConversionAODBGHandlerRP(
@@ -607,6 +620,26 @@ void AliAnalysisTaskGammaConvV1::UserCreateOutputObjects(){
   // Array of current cut's gammas
   fGammaCandidates          = new TList();
 
+  // Group cut configurations with identical photon cuts, which then share the photon selection
+  if(fSharePhotonSelection){
+    fPhotonCutGroup         = new Int_t[fnCuts];
+    Int_t nShared           = 0;
+    for(Int_t iCut = 0; iCut<fnCuts;iCut++){
+      fPhotonCutGroup[iCut] = iCut;
+      for(Int_t jCut = 0; jCut<iCut;jCut++){
+        if(((AliConversionPhotonCuts*)fCutArray->At(iCut))->HasSamePhotonSelection((AliConversionPhotonCuts*)fCutArray->At(jCut))){
+          fPhotonCutGroup[iCut] = fPhotonCutGroup[jCut];
+          nShared++;
+          break;
+        }
+      }
+    }
+    if(nShared == 0){
+      delete[] fPhotonCutGroup;
+      fPhotonCutGroup       = NULL;
+    }
+  }
+
   fCutFolder                = new TList*[fnCuts];
   fESDList                  = new TList*[fnCuts];
   if(fDoTHnSparse){
@@ -1643,6 +1676,7 @@ void AliAnalysisTaskGammaConvV1::UserExec(Option_t *)
   }
 
   fReaderGammas = fV0Reader->GetReconstructedGammas(); // Gammas from default Cut
+  if(fPhotonCutGroup) fPhotonSelectionStage.assign(fnCuts*fReaderGammas->GetEntriesFast(),-1);
   
   // ------------------- BeginEvent ----------------------------
 
@@ -1839,6 +1873,25 @@ void AliAnalysisTaskGammaConvV1::UserExec(Option_t *)
   
   PostData(1, fOutputContainer);
 }
+//________________________________________________________________________
+Bool_t AliAnalysisTaskGammaConvV1::PhotonIsSelectedShared(AliAODConversionPhoton *photon, Int_t iPhoton)
+{
+  // PhotonIsSelected for the current cut, evaluated only once per event and photon for all cut
+  // configurations with identical photon cuts. The detailed QA histograms of the photon cuts are
+  // filled by the first configuration evaluating the photon, the others only replay the cut index.
+  AliConversionPhotonCuts *photonCuts = (AliConversionPhotonCuts*)fCutArray->At(fiCut);
+  if(!fPhotonCutGroup) return photonCuts->PhotonIsSelected(photon,fInputEvent);
+
+  Char_t &stage = fPhotonSelectionStage[fPhotonCutGroup[fiCut]*fReaderGammas->GetEntriesFast()+iPhoton];
+  if(stage < 0){
+    photonCuts->PhotonIsSelected(photon,fInputEvent);
+    stage = photonCuts->GetLastPhotonCutStage();
+  } else {
+    photonCuts->FillPhotonCutIndexFromStage(stage);
+  }
+  return stage == AliConversionPhotonCuts::kPhotonOut;
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskGammaConvV1::ProcessPhotonCandidates()
 {
@@ -1861,7 +1914,7 @@ void AliAnalysisTaskGammaConvV1::ProcessPhotonCandidates()
       if( (isNegFromMBHeader+isPosFromMBHeader) != 4) fIsFromSelectedHeader = kFALSE;
     }
   
-    if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->PhotonIsSelected(PhotonCandidate,fInputEvent)) continue;
+    if(!PhotonIsSelectedShared(PhotonCandidate,i)) continue;
     if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->InPlaneOutOfPlaneCut(PhotonCandidate->GetPhotonPhi(),fEventPlaneAngle)) continue;
     if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->UseElecSharingCut() &&
       !((AliConversionPhotonCuts*)fCutArray->At(fiCut))->UseToCloseV0sCut()){
@@ -3447,18 +3500,23 @@ void AliAnalysisTaskGammaConvV1::CalculateBackground(){
     }
   } else {
     AliGammaConversionAODBGHandler::GammaConversionVertex *bgEventVertex = NULL;
+    // with the compact pool the background photons are rebuilt from the stored kinematics
+    Bool_t useCompactPool = fBGHandler[fiCut]->GetUseCompactPool();
+    AliAODConversionPhoton poolGoodV0;
 
     if(((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->UseTrackMultiplicity()){
       for(Int_t nEventsInBG=0;nEventsInBG<fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
         AliGammaConversionAODVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
+        Int_t nPreviousV0s = useCompactPool ? fBGHandler[fiCut]->GetNBGPhotons(zbin,mbin,nEventsInBG) : (Int_t)previousEventV0s->size();
         if(fMoveParticleAccordingToVertex == kTRUE || ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
           bgEventVertex = fBGHandler[fiCut]->GetBGEventVertex(zbin,mbin,nEventsInBG);
         }
 
         for(Int_t iCurrent=0;iCurrent<fGammaCandidates->GetEntries();iCurrent++){
         AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent));
-        for(Int_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
-          AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
+        for(Int_t iPrevious=0;iPrevious<nPreviousV0s;iPrevious++){
+          if(useCompactPool) fBGHandler[fiCut]->FillBGPhoton(zbin,mbin,nEventsInBG,iPrevious,&poolGoodV0);
+          AliAODConversionPhoton previousGoodV0 = useCompactPool ? poolGoodV0 : *(previousEventV0s->at(iPrevious));
           if(fMoveParticleAccordingToVertex == kTRUE){
             MoveParticleAccordingToVertex(&previousGoodV0,bgEventVertex);
           }
@@ -3487,14 +3545,16 @@ void AliAnalysisTaskGammaConvV1::CalculateBackground(){
       for(Int_t nEventsInBG=0;nEventsInBG <fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
         AliGammaConversionAODVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
         if(previousEventV0s){
+        Int_t nPreviousV0s = useCompactPool ? fBGHandler[fiCut]->GetNBGPhotons(zbin,mbin,nEventsInBG) : (Int_t)previousEventV0s->size();
         if(fMoveParticleAccordingToVertex == kTRUE || ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
           bgEventVertex = fBGHandler[fiCut]->GetBGEventVertex(zbin,mbin,nEventsInBG);
         }
         for(Int_t iCurrent=0;iCurrent<fGammaCandidates->GetEntries();iCurrent++){
           AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent));
-          for(Int_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
+          for(Int_t iPrevious=0;iPrevious<nPreviousV0s;iPrevious++){
 
-            AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
+            if(useCompactPool) fBGHandler[fiCut]->FillBGPhoton(zbin,mbin,nEventsInBG,iPrevious,&poolGoodV0);
+            AliAODConversionPhoton previousGoodV0 = useCompactPool ? poolGoodV0 : *(previousEventV0s->at(iPrevious));
 
             if(fMoveParticleAccordingToVertex == kTRUE){
               MoveParticleAccordingToVertex(&previousGoodV0,bgEventVertex);
@@ -43,7 +43,10 @@ class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
     void SetDoPlotVsCentrality(Bool_t flag)                       { fDoPlotVsCentrality         = flag    ;}
     void SetDoTHnSparse(Bool_t flag)                              { fDoTHnSparse                = flag    ;}
     void SetDoCentFlattening(Int_t flag)                          { fDoCentralityFlat           = flag    ;}
+    void SetSharePhotonSelection(Bool_t flag)                     { fSharePhotonSelection       = flag    ;}
+    void SetUseCompactBGPool(Bool_t flag)                         { fUseCompactBGPool           = flag    ;}
     void ProcessPhotonCandidates();
+    Bool_t PhotonIsSelectedShared(AliAODConversionPhoton *photon, Int_t iPhoton);
     void ProcessClusters();
     void CalculatePi0Candidates();
     void CalculateBackground();
@@ -300,6 +303,10 @@ class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
     Double_t*                         fWeightCentrality;                          //[fnCuts], weight for centrality flattening
     Bool_t                            fEnableClusterCutsForTrigger;               //enables ClusterCuts for Trigger
     Bool_t                            fDoMaterialBudgetWeightingOfGammasForTrueMesons;
+    Bool_t                            fSharePhotonSelection;                      // evaluate the photon selection once per photon for all cut configurations with the same photon cuts
+    Int_t*                            fPhotonCutGroup;                            //! [fnCuts] first cut configuration with the same photon cuts
+    std::vector<Char_t>               fPhotonSelectionStage;                      //! per event: photon selection outcome per photon cut group and photon, -1 if not yet evaluated
+    Bool_t                            fUseCompactBGPool;                          // keep only the photon kinematics in the mixed event pool
     TTree*                            tBrokenFiles;                               // tree for keeping track of broken files
     TObjString*                       fFileNameBroken;                            // string object for broken file name
 
@@ -307,7 +314,7 @@ class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
 
     AliAnalysisTaskGammaConvV1(const AliAnalysisTaskGammaConvV1&); // Prevent copy-construction
     AliAnalysisTaskGammaConvV1 &operator=(const AliAnalysisTaskGammaConvV1&); // Prevent assignment
-    ClassDef(AliAnalysisTaskGammaConvV1, 40);
+    ClassDef(AliAnalysisTaskGammaConvV1, 42);
 };
 
 #endif
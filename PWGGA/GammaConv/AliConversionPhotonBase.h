@@ -92,6 +92,7 @@ class AliConversionPhotonBase {
   void GetDistanceOfClossetApproachToPrimVtx(const AliVVertex* primVertex, Float_t * dca);
   void DeterminePhotonQuality(AliVTrack* negTrack, AliVTrack* posTrack);
   UChar_t GetPhotonQuality() const {return fQuality;}
+  void SetPhotonQuality(UChar_t quality) {fQuality=quality;}
   // Armenteros Qt Alpha
   void GetArmenterosQtAlpha(Double_t qtalpha[2]){qtalpha[0]=fArmenteros[0];qtalpha[1]=fArmenteros[1];}
   Double_t GetArmenterosQt() const {return fArmenteros[0];}
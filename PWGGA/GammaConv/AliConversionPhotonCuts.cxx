@@ -216,7 +216,8 @@ AliConversionPhotonCuts::AliConversionPhotonCuts(const char *name,const char *ti
   fPreSelCut(kFALSE),
   fProcessAODCheck(kFALSE),
   fProfileContainingMaterialBudgetWeights(NULL),
-  fMaterialBudgetWeightsInitialized(kFALSE)
+  fMaterialBudgetWeightsInitialized(kFALSE),
+  fLastPhotonCutStage(kPhotonIn)
 {
   InitPIDResponse();
   for(Int_t jj=0;jj<kNCuts;jj++){fCuts[jj]=0;}
@@ -349,7 +350,8 @@ AliConversionPhotonCuts::AliConversionPhotonCuts(const AliConversionPhotonCuts &
   fPreSelCut(ref.fPreSelCut),
   fProcessAODCheck(ref.fProcessAODCheck),
   fProfileContainingMaterialBudgetWeights(ref.fProfileContainingMaterialBudgetWeights),
-  fMaterialBudgetWeightsInitialized(ref.fMaterialBudgetWeightsInitialized)
+  fMaterialBudgetWeightsInitialized(ref.fMaterialBudgetWeightsInitialized),
+  fLastPhotonCutStage(kPhotonIn)
 {
   // Copy Constructor
   for(Int_t jj=0;jj<kNCuts;jj++){fCuts[jj]=ref.fCuts[jj];}
@@ -952,10 +954,12 @@ Bool_t AliConversionPhotonCuts::PhotonIsSelected(AliConversionPhotonBase *photon
   //Selection of Reconstructed Photons
 
   FillPhotonCutIndex(kPhotonIn);
+  fLastPhotonCutStage = kPhotonIn;
 
   if(event->IsA()==AliESDEvent::Class()) {
     if(!SelectV0Finder( ( ((AliESDEvent*)event)->GetV0(photon->GetV0Index()))->GetOnFlyStatus() ) ){
       FillPhotonCutIndex(kOnFly);
+      fLastPhotonCutStage = kOnFly;
       return kFALSE;
     }
   }
@@ -966,6 +970,7 @@ Bool_t AliConversionPhotonCuts::PhotonIsSelected(AliConversionPhotonBase *photon
 
   if(!negTrack || !posTrack) {
     FillPhotonCutIndex(kNoTracks);
+    fLastPhotonCutStage = kNoTracks;
     return kFALSE;
   }
 
@@ -987,6 +992,7 @@ Bool_t AliConversionPhotonCuts::PhotonIsSelected(AliConversionPhotonBase *photon
     }
     if(!bFound){
       FillPhotonCutIndex(kNoV0);
+      fLastPhotonCutStage = kNoV0;
       return kFALSE;
     }
   }
@@ -995,6 +1001,7 @@ Bool_t AliConversionPhotonCuts::PhotonIsSelected(AliConversionPhotonBase *photon
   // Track Cuts
   if(!TracksAreSelected(negTrack, posTrack)){
     FillPhotonCutIndex(kTrackCuts);
+    fLastPhotonCutStage = kTrackCuts;
     return kFALSE;
   }
   if (fHistoEtaDistV0s)fHistoEtaDistV0s->Fill(photon->GetPhotonEta());
@@ -1002,6 +1009,7 @@ Bool_t AliConversionPhotonCuts::PhotonIsSelected(AliConversionPhotonBase *photon
   
   if(!KappaCuts(photon, event) || !dEdxCuts(negTrack) || !dEdxCuts(posTrack)) {
     FillPhotonCutIndex(kdEdxCuts);
+    fLastPhotonCutStage = kdEdxCuts;
     return kFALSE;
   }
     
@@ -1009,11 +1017,13 @@ Bool_t AliConversionPhotonCuts::PhotonIsSelected(AliConversionPhotonBase *photon
   // Photon Cuts
   if(!PhotonCuts(photon,event)){
     FillPhotonCutIndex(kPhotonCuts);
+    fLastPhotonCutStage = kPhotonCuts;
     return kFALSE;
   }
   
   // Photon passed cuts
   FillPhotonCutIndex(kPhotonOut);
+  fLastPhotonCutStage = kPhotonOut;
   return kTRUE;
 }
 
@@ -3289,6 +3299,21 @@ TString AliConversionPhotonCuts::GetCutNumber(){
   return a;
 }
 
+///________________________________________________________________________
+Bool_t AliConversionPhotonCuts::HasSamePhotonSelection(const AliConversionPhotonCuts *cuts) const {
+  // returns kTRUE if PhotonIsSelected gives the same answer for both cut objects,
+  // i.e. same cut string and same settings outside of the cut string
+  if(!cuts) return kFALSE;
+  for(Int_t ii=0;ii<kNCuts;ii++){
+    if(fCuts[ii] != cuts->fCuts[ii]) return kFALSE;
+  }
+  if(fPreSelCut != cuts->fPreSelCut || fProcessAODCheck != cuts->fProcessAODCheck) return kFALSE;
+  if(fIsHeavyIon != cuts->fIsHeavyIon) return kFALSE;
+  if(fDodEdxSigmaCut != cuts->fDodEdxSigmaCut || fSwitchToKappa != cuts->fSwitchToKappa) return kFALSE;
+  if(fV0ReaderName.CompareTo(cuts->fV0ReaderName) != 0) return kFALSE;
+  return kTRUE;
+}
+
 ///________________________________________________________________________
 void AliConversionPhotonCuts::FillElectonLabelArray(AliAODConversionPhoton* photon, Int_t nV0){
 
@@ -135,6 +135,9 @@ class AliConversionPhotonCuts : public AliAnalysisCuts {
     void SetFillCutHistograms(TString name="",Bool_t preCut = kTRUE){if(!fHistograms){InitCutHistograms(name,preCut);};}
     TList *GetCutHistograms(){return fHistograms;}
     void FillPhotonCutIndex(Int_t photoncut){if(fHistoCutIndex)fHistoCutIndex->Fill(photoncut);}    
+    void FillPhotonCutIndexFromStage(Int_t stage){FillPhotonCutIndex(kPhotonIn); FillPhotonCutIndex(stage);}
+    Int_t GetLastPhotonCutStage() const {return fLastPhotonCutStage;}
+    Bool_t HasSamePhotonSelection(const AliConversionPhotonCuts *cuts) const;
     void FillV0EtaBeforedEdxCuts(Float_t v0Eta){if(fHistoEtaDistV0s)fHistoEtaDistV0s->Fill(v0Eta);}
     void FillV0EtaAfterdEdxCuts(Float_t v0Eta){if(fHistoEtaDistV0sAfterdEdxCuts)fHistoEtaDistV0sAfterdEdxCuts->Fill(v0Eta);}
 
@@ -344,6 +347,7 @@ class AliConversionPhotonCuts : public AliAnalysisCuts {
     Bool_t            fPreSelCut;                           // Flag for preselection cut used in V0Reader
     Bool_t            fProcessAODCheck;                     // Flag for processing check for AOD to be contained in AliAODs.root and AliAODGammaConversion.root
     TProfile*         fProfileContainingMaterialBudgetWeights;      
+    Int_t             fLastPhotonCutStage;                  //! outcome (photonCuts) of the last PhotonIsSelected call
 
   private:
   
@@ -44,7 +44,9 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler() :
 	fBinLimitsArrayMultiplicity(NULL),
 	fBGEvents(),
 	fBGEventsENeg(),
-	fBGEventsMeson()
+	fBGEventsMeson(),
+	fUseCompactPool(kFALSE),
+	fBGPools()
 {
 	// constructor
 }
@@ -64,7 +66,9 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler(Int_t binsZ,Int_t
 	fBinLimitsArrayMultiplicity(NULL),
 	fBGEvents(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
 	fBGEventsENeg(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
-	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents)))
+	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents))),
+	fUseCompactPool(kFALSE),
+	fBGPools()
 {
 	// constructor
 }
@@ -86,7 +90,9 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler(Int_t collisionSy
 	fBinLimitsArrayMultiplicity(NULL),
 	fBGEvents(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
 	fBGEventsENeg(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
-	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents)))
+	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents))),
+	fUseCompactPool(kFALSE),
+	fBGPools()
 {
 	// constructor
     if(fNBinsZ>8) fNBinsZ = 8;
@@ -357,7 +363,9 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler(const AliGammaCon
 	fBinLimitsArrayMultiplicity(original.fBinLimitsArrayMultiplicity),
 	fBGEvents(original.fBGEvents),
 	fBGEventsENeg(original.fBGEventsENeg),
-	fBGEventsMeson(original.fBGEventsMeson)
+	fBGEventsMeson(original.fBGEventsMeson),
+	fUseCompactPool(original.fUseCompactPool),
+	fBGPools(original.fBGPools)
 {
 	//copy constructor	
 }
@@ -583,6 +591,33 @@ void AliGammaConversionAODBGHandler::AddEvent(TList* const eventGammas,Double_t
 	fBGEventVertex[z][m][eventCounter].fZ = zvalue;
 	fBGEventVertex[z][m][eventCounter].fEP = epvalue;
 
+	if(fUseCompactPool){
+		// overwrite the columns of the oldest event, their capacity is kept across events
+		GammaConversionPhotonPool &pool = fBGPools[z][m][eventCounter];
+		Int_t nGammas = eventGammas->GetEntries();
+		pool.fPx.resize(nGammas);
+		pool.fPy.resize(nGammas);
+		pool.fPz.resize(nGammas);
+		pool.fE.resize(nGammas);
+		pool.fConvX.resize(nGammas);
+		pool.fConvY.resize(nGammas);
+		pool.fConvZ.resize(nGammas);
+		pool.fQuality.resize(nGammas);
+		for(Int_t i=0; i<nGammas; i++){
+			AliAODConversionPhoton *gamma = (AliAODConversionPhoton*)(eventGammas->At(i));
+			pool.fPx[i] = gamma->Px();
+			pool.fPy[i] = gamma->Py();
+			pool.fPz[i] = gamma->Pz();
+			pool.fE[i] = gamma->E();
+			pool.fConvX[i] = gamma->GetConversionX();
+			pool.fConvY[i] = gamma->GetConversionY();
+			pool.fConvZ[i] = gamma->GetConversionZ();
+			pool.fQuality[i] = gamma->GetPhotonQuality();
+		}
+		fBGEventCounter[z][m]++;
+		return;
+	}
+
 	//first clear the vector
 	// cout<<"Size of vector: "<<fBGEvents[z][m][eventCounter].size()<<endl;
 	//  cout<<"Checking the entries: Z="<<z<<", M="<<m<<", eventCounter="<<eventCounter<<endl;
@@ -669,6 +704,28 @@ AliGammaConversionAODVector* AliGammaConversionAODBGHandler::GetBGGoodV0s(Int_t
 	return &(fBGEvents[zbin][mbin][event]);
 }
 
+//_____________________________________________________________________________________________________________________________
+void AliGammaConversionAODBGHandler::SetUseCompactPool(Bool_t flag){
+	//see headerfile for documentation
+	fUseCompactPool = flag;
+	if(fUseCompactPool){
+		fBGPools.assign(fNBinsZ,AliGammaConversionPoolMultipicityVector(fNBinsMultiplicity,AliGammaConversionPoolEventVector(fNEvents)));
+	} else {
+		fBGPools.clear();
+	}
+}
+
+//_____________________________________________________________________________________________________________________________
+void AliGammaConversionAODBGHandler::FillBGPhoton(Int_t zbin, Int_t mbin, Int_t event, Int_t photon, AliAODConversionPhoton *gamma) const{
+	// sets the kinematics, conversion point and quality of a stored background photon,
+	// allows to re-use the same photon object for the whole pool
+	const GammaConversionPhotonPool &pool = fBGPools[zbin][mbin][event];
+	gamma->SetPxPyPzE(pool.fPx[photon],pool.fPy[photon],pool.fPz[photon],pool.fE[photon]);
+	Double_t convPoint[3] = {pool.fConvX[photon],pool.fConvY[photon],pool.fConvZ[photon]};
+	gamma->SetConversionPoint(convPoint);
+	gamma->SetPhotonQuality(pool.fQuality[photon]);
+}
+
 //_____________________________________________________________________________________________________________________________
 AliGammaConversionMotherAODVector* AliGammaConversionAODBGHandler::GetBGGoodMesons(Int_t zbin, Int_t mbin, Int_t event){
 	//see headerfile for documentation
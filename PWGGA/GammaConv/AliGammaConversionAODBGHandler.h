@@ -40,6 +40,23 @@ class AliGammaConversionAODBGHandler : public TObject {
 	
 	typedef struct GammaConversionVertex GammaConversionVertex; 																//!
 
+	// kinematics of the photons of one background event needed for the pairing, stored column-wise
+	struct GammaConversionPhotonPool{
+		vector<Double_t> fPx;
+		vector<Double_t> fPy;
+		vector<Double_t> fPz;
+		vector<Double_t> fE;
+		vector<Double_t> fConvX;
+		vector<Double_t> fConvY;
+		vector<Double_t> fConvZ;
+		vector<UChar_t>  fQuality;
+		Int_t GetEntries() const {return (Int_t)fPx.size();}
+	};
+
+	typedef vector<GammaConversionPhotonPool> AliGammaConversionPoolEventVector;
+	typedef vector<AliGammaConversionPoolEventVector> AliGammaConversionPoolMultipicityVector;
+	typedef vector<AliGammaConversionPoolMultipicityVector> AliGammaConversionPoolVector;
+
 	typedef vector<AliGammaConversionAODVector> AliGammaConversionBGEventVector;
 	typedef vector<AliGammaConversionBGEventVector> AliGammaConversionMultipicityVector;
 	typedef vector<AliGammaConversionMultipicityVector> AliGammaConversionBGVector;
@@ -69,6 +86,13 @@ class AliGammaConversionAODBGHandler : public TObject {
 
 	// Get BG photons
 	AliGammaConversionAODVector* GetBGGoodV0s(Int_t zbin, Int_t mbin, Int_t event);
+	// Compact photon pool: only the kinematics needed for the pairing are kept, no photon copies are made.
+	// Has to be enabled before the first AddEvent, GetBGGoodV0s then returns empty vectors
+	void SetUseCompactPool(Bool_t flag = kTRUE);
+	Bool_t GetUseCompactPool() const {return fUseCompactPool;}
+	Int_t GetNBGPhotons(Int_t zbin, Int_t mbin, Int_t event) const {return fBGPools[zbin][mbin][event].GetEntries();}
+	const GammaConversionPhotonPool* GetBGPhotonPool(Int_t zbin, Int_t mbin, Int_t event) const {return &fBGPools[zbin][mbin][event];}
+	void FillBGPhoton(Int_t zbin, Int_t mbin, Int_t event, Int_t photon, AliAODConversionPhoton *gamma) const;
 	// Get BG mesons
 	AliGammaConversionMotherAODVector* GetBGGoodMesons(Int_t zbin, Int_t mbin, Int_t event);
 	// Get BG electron
@@ -95,7 +119,9 @@ class AliGammaConversionAODBGHandler : public TObject {
 		AliGammaConversionBGVector 			fBGEvents; 						// photon background events
 		AliGammaConversionBGVector 			fBGEventsENeg; 					// electron background electron events
 		AliGammaConversionMotherBGVector 	fBGEventsMeson; 				// neutral meson background events
+		Bool_t								fUseCompactPool;				// store only the photon kinematics in fBGPools
+		AliGammaConversionPoolVector		fBGPools;						//! compact photon background events
 		
-	ClassDef(AliGammaConversionAODBGHandler,5)
+	ClassDef(AliGammaConversionAODBGHandler,6)
 };
 #endif
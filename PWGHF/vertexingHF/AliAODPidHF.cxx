@@ -28,6 +28,7 @@
 #include <TFile.h>
 
 #include "AliAODPidHF.h"
+#include "AliHFCandidateCache.h"
 #include "AliAODPid.h"
 #include "AliPID.h"
 #include "AliPIDResponse.h"
@@ -81,7 +82,8 @@ fTPCResponse(new AliTPCPIDResponse()),
 fPriorsH(),
 fCombDetectors(kTPCTOF),
 fUseCombined(kFALSE),
-fDefaultPriors(kTRUE)
+fDefaultPriors(kTRUE),
+fUseNsigmaCache(kFALSE)
 {
   ///
   /// Default constructor
@@ -186,7 +188,8 @@ fPidCombined(0x0),
 fTPCResponse(0x0),
 fCombDetectors(pid.fCombDetectors),
 fUseCombined(pid.fUseCombined),
-fDefaultPriors(pid.fDefaultPriors)
+fDefaultPriors(pid.fDefaultPriors),
+fUseNsigmaCache(pid.fUseNsigmaCache)
 {
   
   fnSigmaCompat=new Double_t[fnNSigmaCompat];
@@ -907,7 +910,15 @@ Int_t AliAODPidHF::GetnSigmaTPC(AliAODTrack *track, Int_t species, Double_t &nsi
   } else{
     if(!fPidResponse) return -1;
     AliPID::EParticleType type=AliPID::EParticleType(species);
-    nsigmaTPC = fPidResponse->NumberOfSigmasTPC(track,type);
+    if(fUseNsigmaCache) {
+      AliHFCandidateCache *cache=AliHFCandidateCache::Instance();
+      if(!cache->GetnSigma(track,AliHFCandidateCache::kTPC,species,nsigmaTPC)) {
+	nsigmaTPC = fPidResponse->NumberOfSigmasTPC(track,type);
+	cache->SetnSigma(track,AliHFCandidateCache::kTPC,species,nsigmaTPC);
+      }
+    } else {
+      nsigmaTPC = fPidResponse->NumberOfSigmasTPC(track,type);
+    }
     nsigma=nsigmaTPC;
   }
   return 1;
@@ -921,7 +932,15 @@ Int_t AliAODPidHF::GetnSigmaTOF(AliAODTrack *track,Int_t species, Double_t &nsig
   if(!CheckTOFPIDStatus(track)) return -1;
   
   if(fPidResponse){
-    nsigma = fPidResponse->NumberOfSigmasTOF(track,(AliPID::EParticleType)species);
+    if(fUseNsigmaCache) {
+      AliHFCandidateCache *cache=AliHFCandidateCache::Instance();
+      if(!cache->GetnSigma(track,AliHFCandidateCache::kTOF,species,nsigma)) {
+	nsigma = fPidResponse->NumberOfSigmasTOF(track,(AliPID::EParticleType)species);
+	cache->SetnSigma(track,AliHFCandidateCache::kTOF,species,nsigma);
+      }
+    } else {
+      nsigma = fPidResponse->NumberOfSigmasTOF(track,(AliPID::EParticleType)species);
+    }
     return 1;
   }else{
     AliFatal("To use TOF PID you need to attach AliPIDResponseTask");
@@ -109,6 +109,7 @@ public:
   void SetPtThresholdTPC(Double_t ptThresholdTPC){fPtThresholdTPC=ptThresholdTPC;return;}
   void SetMaxTrackMomForCombinedPID(Double_t mom){fMaxTrackMomForCombinedPID=mom;}
   void SetPidResponse(AliPIDResponse *pidResp) {fPidResponse=pidResp;return;}
+  void SetUseNsigmaCache(Bool_t opt=kTRUE) {fUseNsigmaCache=opt;return;}
   void SetCombDetectors(ECombDetectors pidComb) {
     fCombDetectors=pidComb;
   }
@@ -283,6 +284,7 @@ private:
   ECombDetectors fCombDetectors; /// detectors to be involved for combined PID
   Bool_t fUseCombined; /// detectors to be involved for combined PID
   Bool_t fDefaultPriors; /// use default priors for combined PID
+  Bool_t fUseNsigmaCache; //!<! share nsigma values via AliHFCandidateCache
 
   /// Storage of identification/compatibility band for different species and detectors:
   TF1 *fIdBandMin[AliPID::kSPECIES][4];
@@ -1256,11 +1256,11 @@ void AliAnalysisTaskSED0Mass::UserExec(Option_t */*option*/)
       nSelectedloose++;
       nSelectedtight++;      
       if(fSys==0){
-	if(fCuts->IsSelected(d,AliRDHFCuts::kTracks,aod))fNentries->Fill(6);       
+	if(fCuts->IsSelectedCached(d,AliRDHFCuts::kTracks,aod))fNentries->Fill(6);       
       }
       Int_t ptbin=fCuts->PtBin(d->Pt());
       if(ptbin==-1) {fNentries->Fill(4); continue;} //out of bounds
-      fIsSelectedCandidate=fCuts->IsSelected(d,AliRDHFCuts::kAll,aod); //selected
+      fIsSelectedCandidate=fCuts->IsSelectedCached(d,AliRDHFCuts::kAll,aod); //selected
       if(fFillVarHists) {
 	//if(!fCutOnDistr || (fCutOnDistr && fIsSelectedCandidate)) {
 	fDaughterTracks.AddAt((AliAODTrack*)d->GetDaughter(0),0);
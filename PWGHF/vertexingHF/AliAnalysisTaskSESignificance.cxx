@@ -88,7 +88,8 @@ AliAnalysisTaskSESignificance::AliAnalysisTaskSESignificance():
   fNVars(0),
   fNBins(100),
   fPartOrAndAntiPart(0),
-  fDsChannel(0)
+  fDsChannel(0),
+  fCumulativeFill(kFALSE)
 {
   // Default constructor
   SetPDGCodes();
@@ -128,7 +129,8 @@ AliAnalysisTaskSESignificance::AliAnalysisTaskSESignificance(const char *name, T
   fNVars(0),
   fNBins(100),
   fPartOrAndAntiPart(0),
-  fDsChannel(0)
+  fDsChannel(0),
+  fCumulativeFill(kFALSE)
 {
 
   SetPDGCodes();
@@ -574,7 +576,7 @@ void AliAnalysisTaskSESignificance::UserExec(Option_t */*option*/)
     }
     
     Bool_t isFidAcc = fRDCuts->IsInFiducialAcceptance(d->Pt(),d->Y(fPDGmother));
-    Int_t isSelected=fRDCuts->IsSelected(d,fSelectionlevel,aod);
+    Int_t isSelected=fRDCuts->IsSelectedCached(d,fSelectionlevel,aod);
 
     if(fReadMC && fBFeedDown!=kBoth && isSelected){
       Int_t labD = d->MatchToMC(fPDGmother,arrayMC,fNProngs,fPDGdaughters);
@@ -602,12 +604,37 @@ void AliAnalysisTaskSESignificance::UserExec(Option_t */*option*/)
     
       Int_t nVals=0;
       if(fDecChannel==3) SetPDGdaughterDstoKKpi();
-      fRDCuts->GetCutVarsForOpt(d,fVars,fNVars,fPDGdaughters,aod);
+      fRDCuts->GetCutVarsForOptCached(d,fVars,fNVars,fPDGdaughters,aod);
       Int_t ptbin=fRDCuts->PtBin(d->Pt());
       if(ptbin==-1) continue;
       TString mdvname=Form("multiDimVectorPtBin%d",ptbin);
       AliMultiDimVector* muvec=(AliMultiDimVector*)fCutList->FindObject(mdvname.Data());
 
+      if(fCumulativeFill){
+	// one fill in the tightest cell passed by the candidate,
+	// the loose cells are cumulated in FinishTaskOutput
+	Int_t ptbinmv=muvec->GetPtBin((Float_t)d->Pt());
+	if(ptbinmv<0) continue;
+	// candidates in cuts: one count per cell passed, as in the non cumulative fill
+	// (for Ds with the KKpi variables, whatever the selected hypotheses)
+	Int_t nCells=muvec->GetNCellsAboveCuts(fVars);
+	for(Int_t icell=0;icell<nCells;icell++) fHistNEvents->Fill(3);
+	Int_t ind[kMaxCutVar];
+	if((fDecChannel!=3 || isSelected&1) && muvec->GetIndicesFromValues(fVars,ind)){
+	  ULong64_t cell=muvec->GetGlobalAddressFromIndices(ind,ptbinmv);
+	  FillCandidate(d,DStarToD0pi,arrayMC,(Int_t)(ptbin*nHistpermv+cell),isSelected,1);
+	}
+	if(fDecChannel==3 && isSelected&2){
+	  SetPDGdaughterDstopiKK();
+	  fRDCuts->GetCutVarsForOptCached(d,fVars,fNVars,fPDGdaughters,aod);
+	  if(muvec->GetIndicesFromValues(fVars,ind)){
+	    ULong64_t cell=muvec->GetGlobalAddressFromIndices(ind,ptbinmv);
+	    FillCandidate(d,DStarToD0pi,arrayMC,(Int_t)(ptbin*nHistpermv+cell),isSelected,0);
+	  }
+	}
+	continue;
+      }
+
       ULong64_t *addresses = muvec->GetGlobalAddressesAboveCuts(fVars,(Float_t)d->Pt(),nVals);
       if(fDebug>1)printf("nvals = %d\n",nVals);
       for(Int_t ivals=0;ivals<nVals;ivals++){
@@ -650,7 +677,7 @@ void AliAnalysisTaskSESignificance::UserExec(Option_t */*option*/)
       if (fDecChannel==3 && isSelected&2){
 	SetPDGdaughterDstopiKK();
 	nVals=0;
-	fRDCuts->GetCutVarsForOpt(d,fVars,fNVars,fPDGdaughters,aod);
+	fRDCuts->GetCutVarsForOptCached(d,fVars,fNVars,fPDGdaughters,aod);
 	delete [] addresses;
 	addresses = muvec->GetGlobalAddressesAboveCuts(fVars,(Float_t)d->Pt(),nVals);
 	if(fDebug>1)printf("nvals = %d\n",nVals);
@@ -676,10 +703,61 @@ void AliAnalysisTaskSESignificance::UserExec(Option_t */*option*/)
   return;
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskSESignificance::FinishTaskOutput()
+{
+  // With the cumulative fill, each candidate was filled in the tightest cut
+  // set it passes: cumulate the histograms over the looser cut sets.
+  // Done on each worker before merging (the operation is linear)
+
+  if(!fCumulativeFill || !fOutput) return;
+  AliMultiDimVector* mdvtmp=(AliMultiDimVector*)fCutList->FindObject("multiDimVectorPtBin0");
+  if(!mdvtmp) return;
+  Int_t nHistpermv=mdvtmp->GetNTotCells();
+  for(Int_t ptbin=0;ptbin<fNPtBins;ptbin++){
+    TString mdvname=Form("multiDimVectorPtBin%d",ptbin);
+    AliMultiDimVector* muvec=(AliMultiDimVector*)fCutList->FindObject(mdvname.Data());
+    if(!muvec) continue;
+    Int_t offset=ptbin*nHistpermv;
+    muvec->IntegrateCells(&fMassHist[offset]);
+    if(fReadMC){
+      muvec->IntegrateCells(&fSigHist[offset]);
+      muvec->IntegrateCells(&fBkgHist[offset]);
+      if(fDecChannel != AliAnalysisTaskSESignificance::kDplustoKpipi) muvec->IntegrateCells(&fRflHist[offset]);
+    }
+  }
+}
+
 //***************************************************************************
 
 // Methods used in the UserExec
 
+void AliAnalysisTaskSESignificance::FillCandidate(AliAODRecoDecayHF* d,AliAODRecoCascadeHF* dstarD0pi,TClonesArray *arrayMC,Int_t index,Int_t isSelected,Int_t optDecayDs){
+  // fill the histograms of cut set index with the appropriate method
+  switch (fDecChannel){
+  case 0:
+    FillDplus(d,arrayMC,index,isSelected);
+    break;
+  case 1:
+    FillD02p(d,arrayMC,index,isSelected);
+    break;
+  case 2:
+    FillDstar(dstarD0pi,arrayMC,index,isSelected);
+    break;
+  case 3:
+    FillDs(d,arrayMC,index,isSelected,optDecayDs);
+    break;
+  case 4:
+    FillD04p(d,arrayMC,index,isSelected);
+    break;
+  case 5:
+    FillLambdac(d,arrayMC,index,isSelected);
+    break;
+  default:
+    break;
+  }
+}
+
 
 //********************************************************************************************
 
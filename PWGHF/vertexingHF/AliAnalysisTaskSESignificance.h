@@ -46,6 +46,9 @@ class AliAnalysisTaskSESignificance : public AliAnalysisTaskSE
   void SetDsChannel(Int_t chan){fDsChannel=chan;}
   void SetUseSelBit(Bool_t selBit=kTRUE){fUseSelBit=selBit;}
   void SetAODMismatchProtection(Int_t opt=1) {fAODProtection=opt;}
+  /// fill each candidate only in the tightest cut set it passes and
+  /// cumulate the mass histograms over the cut grid at the end of the job
+  void SetCumulativeFill(Bool_t opt=kTRUE){fCumulativeFill=opt;}
 
   //void SetMultiVector(const AliMultiDimVector *MultiDimVec){fMultiDimVec->CopyStructure(MultiDimVec);}
   Float_t GetUpperMassLimit()const {return fUpmasslimit;}
@@ -55,11 +58,13 @@ class AliAnalysisTaskSESignificance : public AliAnalysisTaskSE
   Int_t GetBFeedDown()const {return fBFeedDown;}
   Int_t GetDsChannel()const {return fDsChannel;}
   Bool_t GetUseSelBit()const {return fUseSelBit;}
+  Bool_t GetCumulativeFill()const {return fCumulativeFill;}
 
   /// Implementation of interface methods
   virtual void UserCreateOutputObjects();
   virtual void LocalInit();// {Init();}
   virtual void UserExec(Option_t *option);
+  virtual void FinishTaskOutput();
   virtual void Terminate(Option_t *option);
     
  private:
@@ -92,6 +97,7 @@ class AliAnalysisTaskSESignificance : public AliAnalysisTaskSE
   void FillDstar(AliAODRecoCascadeHF* dstarD0pi,TClonesArray *arrayMC,Int_t index,Int_t isSel);
   void FillD04p(AliAODRecoDecayHF* d,TClonesArray *arrayMC,Int_t index,Int_t isSel);
   void FillLambdac(AliAODRecoDecayHF* d,TClonesArray *arrayMC,Int_t index, Int_t isSel);
+  void FillCandidate(AliAODRecoDecayHF* d,AliAODRecoCascadeHF* dstarD0pi,TClonesArray *arrayMC,Int_t index,Int_t isSelected,Int_t optDecayDs);
 
 
   enum {kMaxPtBins=8};
@@ -129,9 +135,10 @@ class AliAnalysisTaskSESignificance : public AliAnalysisTaskSE
   Int_t fDsChannel;          /// Ds resonant channel selected
   Int_t fPDGDStarToD0pi[2]; /// PDG codes for the particles in the D* -> pi + D0 decay
   Int_t fPDGD0ToKpi[2];    /// PDG codes for the particles in the D0 -> K + pi decay
+  Bool_t fCumulativeFill;  /// fill only the tightest passed cut set, cumulate in FinishTaskOutput
 
   /// \cond CLASSIMP    
-  ClassDef(AliAnalysisTaskSESignificance,6); /// AliAnalysisTaskSE for the MC association of heavy-flavour decay candidates
+  ClassDef(AliAnalysisTaskSESignificance,7); /// AliAnalysisTaskSE for the MC association of heavy-flavour decay candidates
   /// \endcond
 };
 
@@ -38,6 +38,7 @@
 #include "AliVTrack.h"
 #include "AliVertexerTracks.h"
 #include "AliKFVertex.h"
+#include "AliHFDCAFitter.h"
 #include "AliESDEvent.h"
 #include "AliESDVertex.h"
 #include "AliExternalTrackParam.h"
@@ -83,6 +84,8 @@ fAODMap(0),
 fVertexerTracks(0x0),
 fBzkG(0.),
 fSecVtxWithKF(kFALSE),
+fSecVtxWithDCAFitter(kFALSE),
+fDCAFitter(0x0),
 fRecoPrimVtxSkippingTrks(kFALSE),
 fRmTrksFromPrimVtx(kFALSE),
 fV1(0x0),
@@ -178,6 +181,8 @@ fAODMap(source.fAODMap),
 fVertexerTracks(source.fVertexerTracks),
 fBzkG(source.fBzkG),
 fSecVtxWithKF(source.fSecVtxWithKF),
+fSecVtxWithDCAFitter(source.fSecVtxWithDCAFitter),
+fDCAFitter(source.fDCAFitter ? new AliHFDCAFitter(*source.fDCAFitter) : 0x0),
 fRecoPrimVtxSkippingTrks(source.fRecoPrimVtxSkippingTrks),
 fRmTrksFromPrimVtx(source.fRmTrksFromPrimVtx),
 fV1(source.fV1),
@@ -270,6 +275,9 @@ AliAnalysisVertexingHF &AliAnalysisVertexingHF::operator=(const AliAnalysisVerte
   fVertexerTracks = source.fVertexerTracks;
   fBzkG = source.fBzkG;
   fSecVtxWithKF = source.fSecVtxWithKF;
+  fSecVtxWithDCAFitter = source.fSecVtxWithDCAFitter;
+  delete fDCAFitter;
+  fDCAFitter = source.fDCAFitter ? new AliHFDCAFitter(*source.fDCAFitter) : 0x0;
   fRecoPrimVtxSkippingTrks = source.fRecoPrimVtxSkippingTrks;
   fRmTrksFromPrimVtx = source.fRmTrksFromPrimVtx;
   fV1 = source.fV1;
@@ -352,6 +360,7 @@ AliAnalysisVertexingHF::~AliAnalysisVertexingHF() {
   /// Destructor
   if(fV1) { delete fV1; fV1=0; }
   delete fVertexerTracks;
+  delete fDCAFitter;
   if(fTrackFilter) { delete fTrackFilter; fTrackFilter=0; }
   if(fTrackFilter2prongCentral) { delete fTrackFilter2prongCentral; fTrackFilter2prongCentral=0; }
   if(fTrackFilter3prongCentral) { delete fTrackFilter3prongCentral; fTrackFilter3prongCentral=0; }
@@ -2885,6 +2894,14 @@ AliAODVertex* AliAnalysisVertexingHF::PrimaryVertex(const TObjArray *trkArray,
   return vertexAOD;
 }
 //-----------------------------------------------------------------------------
+void AliAnalysisVertexingHF::SetSecVtxWithDCAFitter() {
+  /// Use the lightweight AliHFDCAFitter for the secondary vertices;
+  /// the fitter settings can be changed via GetDCAFitter()
+  fSecVtxWithKF=kFALSE;
+  fSecVtxWithDCAFitter=kTRUE;
+  if(!fDCAFitter) fDCAFitter=new AliHFDCAFitter();
+}
+//-----------------------------------------------------------------------------
 void AliAnalysisVertexingHF::PrintStatus() const {
   /// Print parameters being used
 
@@ -2892,6 +2909,8 @@ void AliAnalysisVertexingHF::PrintStatus() const {
   //   fTrackFilter->Dump();
   if(fSecVtxWithKF) {
     printf("Secondary vertex with Kalman filter package (AliKFParticle)\n");
+  } else if(fSecVtxWithDCAFitter) {
+    printf("Secondary vertex with AliHFDCAFitter\n");
   } else {
     printf("Secondary vertex with AliVertexerTracks\n");
   }
@@ -2950,7 +2969,27 @@ AliAODVertex* AliAnalysisVertexingHF::ReconstructSecondaryVertex(TObjArray *trkA
   AliESDVertex *vertexESD = 0;
   AliAODVertex *vertexAOD = 0;
 
-  if(!fSecVtxWithKF) { // AliVertexerTracks
+  if(fSecVtxWithDCAFitter && fDCAFitter) { // AliHFDCAFitter
+
+    Double_t seed[3]={0.,0.,0.};
+    if(fV1) fV1->GetXYZ(seed);
+    if(!fDCAFitter->Fit(trkArray,fBzkG,seed)) return vertexAOD;
+
+    Double_t pos[3],cov[6];
+    fDCAFitter->GetXYZ(pos);
+    if(pos[0]*pos[0]+pos[1]*pos[1]>8.){
+      // vertex outside beam pipe, reject candidate to avoid propagation through material
+      return vertexAOD;
+    }
+    fDCAFitter->GetCovMatrix(cov);
+    dispersion = fDCAFitter->GetDispersion();
+
+    Int_t nprongs= (useTRefArray ? 0 : trkArray->GetEntriesFast());
+    vertexAOD = new AliAODVertex(pos,cov,fDCAFitter->GetChi2toNDF(),0x0,-1,AliAODVertex::kUndef,nprongs);
+
+    return vertexAOD;
+
+  } else if(!fSecVtxWithKF) { // AliVertexerTracks
 
     fVertexerTracks->SetVtxStart(fV1);
     vertexESD = (AliESDVertex*)fVertexerTracks->VertexForSelectedESDTracks(trkArray);
@@ -43,6 +43,7 @@ class AliESDtrack;
 class AliVEvent;
 class AliAODVertex;
 class AliVertexerTracks;
+class AliHFDCAFitter;
 class AliESDv0;
 class AliAODv0;
 
@@ -73,7 +74,9 @@ class AliAnalysisVertexingHF : public TNamed {
   Bool_t FillRecoCasc(AliVEvent *event,AliAODRecoCascadeHF *rc,Bool_t isDStar,Bool_t recoSecVtx=kFALSE);
   Bool_t RecoSecondaryVertexForCascades(AliVEvent *event, AliAODRecoCascadeHF *rc);
   void PrintStatus() const;
-  void SetSecVtxWithKF() { fSecVtxWithKF=kTRUE; }
+  void SetSecVtxWithKF() { fSecVtxWithKF=kTRUE; fSecVtxWithDCAFitter=kFALSE; }
+  void SetSecVtxWithDCAFitter();
+  AliHFDCAFitter* GetDCAFitter() const { return fDCAFitter; }
   void SetD0toKpiOn() { fD0toKpi=kTRUE; }
   void SetD0toKpiOff() { fD0toKpi=kFALSE; }
   void SetJPSItoEleOn() { fJPSItoEle=kTRUE; }
@@ -257,6 +260,8 @@ class AliAnalysisVertexingHF : public TNamed {
   Double_t fBzkG; /// z componenent of field in kG
 
   Bool_t fSecVtxWithKF; /// if kTRUE use KF vertexer, else AliVertexerTracks
+  Bool_t fSecVtxWithDCAFitter; /// if kTRUE use AliHFDCAFitter
+  AliHFDCAFitter* fDCAFitter; /// lightweight DCA fitter for secondary vertices
 
   Bool_t fRecoPrimVtxSkippingTrks; /// flag for primary vertex reco on the fly
                                    /// for each candidate, w/o its daughters
@@ -420,7 +425,7 @@ class AliAnalysisVertexingHF : public TNamed {
 				  TObjArray *twoTrackArrayV0);
 
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisVertexingHF,27);  // Reconstruction of HF decay candidates
+  ClassDef(AliAnalysisVertexingHF,28);  // Reconstruction of HF decay candidates
   /// \endcond
 };
 
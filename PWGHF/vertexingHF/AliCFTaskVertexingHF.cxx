@@ -1088,7 +1088,7 @@ void AliCFTaskVertexingHF::UserExec(Option_t *)
           }
 
           //Number of ITS cluster requirements
-          Int_t recoITSnCluster = fCuts->IsSelected(charmCandidate, AliRDHFCuts::kTracks, aodEvent);
+          Int_t recoITSnCluster = fCuts->IsSelectedCached(charmCandidate, AliRDHFCuts::kTracks, aodEvent);
           if (recoITSnCluster){
             fCFManager->GetParticleContainer()->Fill(containerInput,kStepRecoITSClusters, fWeight) ;
             icountRecoITSClusters++;
@@ -1097,6 +1097,7 @@ void AliCFTaskVertexingHF::UserExec(Option_t *)
             Bool_t iscutsusingpid = fCuts->GetIsUsePID();
             Int_t recoAnalysisCuts = -1, recoPidSelection = -1;
             fCuts->SetUsePID(kFALSE);
+            // not cached: the selection is done with PID temporarily switched off
             recoAnalysisCuts = fCuts->IsSelected(charmCandidate, AliRDHFCuts::kCandidate, aodEvent);
 
             if (fDecayChannel==33){ // Ds case, where more possibilities are considered
@@ -1126,7 +1127,7 @@ void AliCFTaskVertexingHF::UserExec(Option_t *)
               //pid selection
               //recoPidSelection = fCuts->IsSelected(charmCandidate, AliRDHFCuts::kPID);
               //if((fCuts->CombineSelectionLevels(3,recoAnalysisCuts,recoPidSelection)==isPartOrAntipart)||(fCuts->CombineSelectionLevels(3,recoAnalysisCuts,recoPidSelection)==3)){
-              recoPidSelection = fCuts->IsSelected(charmCandidate, AliRDHFCuts::kCandidate, aodEvent);
+              recoPidSelection = fCuts->IsSelectedCached(charmCandidate, AliRDHFCuts::kCandidate, aodEvent);
 
               if (fDecayChannel==33){ // Ds case, where more possibilities are considered
                 Bool_t keepDs=ProcessDs(recoPidSelection);
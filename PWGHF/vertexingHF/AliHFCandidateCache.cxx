@@ -0,0 +1,182 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/* $Id$ */
+
+/////////////////////////////////////////////////////////////
+//
+// Per-event cache of HF candidate selections, topological
+// variables and PID nsigmas, shared by all the tasks of a train
+//
+/////////////////////////////////////////////////////////////
+
+#include <TString.h>
+#include "AliAnalysisManager.h"
+#include "AliInputEventHandler.h"
+#include "AliVEvent.h"
+#include "AliVTrack.h"
+#include "AliAODRecoDecayHF.h"
+#include "AliHFCandidateCache.h"
+
+/// \cond CLASSIMP
+ClassImp(AliHFCandidateCache);
+/// \endcond
+
+AliHFCandidateCache* AliHFCandidateCache::fgInstance=0x0;
+
+//--------------------------------------------------------------------------
+AliHFCandidateCache::AliHFCandidateCache():
+TObject(),
+fEvent(0x0),
+fEntry(-1),
+fNLookups(0),
+fNHits(0),
+fSelections(),
+fCutVars(),
+fnSigma()
+{
+  /// Default constructor, use Instance()
+}
+//--------------------------------------------------------------------------
+AliHFCandidateCache* AliHFCandidateCache::Instance()
+{
+  /// Access to the process-wide instance
+  if(!fgInstance) fgInstance=new AliHFCandidateCache();
+  return fgInstance;
+}
+//--------------------------------------------------------------------------
+Bool_t AliHFCandidateCache::CheckEvent()
+{
+  /// Invalidate the cache if the input handler moved to another event.
+  /// Returns kFALSE (cache unusable) when running outside an analysis manager
+
+  AliAnalysisManager *mgr=AliAnalysisManager::GetAnalysisManager();
+  if(!mgr) return kFALSE;
+  AliInputEventHandler *inputHandler=(AliInputEventHandler*)mgr->GetInputEventHandler();
+  if(!inputHandler) return kFALSE;
+  const AliVEvent *event=inputHandler->GetEvent();
+  if(!event) return kFALSE;
+  Long64_t entry=mgr->GetCurrentEntry();
+  if(event!=fEvent || entry!=fEntry) {
+    Reset();
+    fEvent=event;
+    fEntry=entry;
+  }
+  return kTRUE;
+}
+//--------------------------------------------------------------------------
+void AliHFCandidateCache::Reset()
+{
+  /// Clear the stored evaluations
+  fSelections.clear();
+  fCutVars.clear();
+  fnSigma.clear();
+  fEvent=0x0;
+  fEntry=-1;
+}
+//--------------------------------------------------------------------------
+UInt_t AliHFCandidateCache::CandidateHash(const AliAODRecoDecayHF *d)
+{
+  /// Hash of the candidate content (prong IDs and momenta, secondary vertex),
+  /// independent of the memory location of the object
+
+  Double_t buf[4*5+4];
+  Int_t n=0;
+  Int_t nProngs=d->GetNProngs();
+  if(nProngs>5) nProngs=5;
+  buf[n++]=nProngs;
+  for(Int_t ip=0; ip<nProngs; ip++) {
+    buf[n++]=d->GetProngID(ip);
+    buf[n++]=d->PxProng(ip);
+    buf[n++]=d->PyProng(ip);
+    buf[n++]=d->PzProng(ip);
+  }
+  buf[n++]=d->GetSecVtxX();
+  buf[n++]=d->GetSecVtxY();
+  buf[n++]=d->GetSecVtxZ();
+  return TString::Hash(buf,n*sizeof(Double_t));
+}
+//--------------------------------------------------------------------------
+Bool_t AliHFCandidateCache::GetSelection(UInt_t candHash,UInt_t cutsHash,Int_t level,
+					 Int_t &result,Int_t &selCuts,Int_t &selPID,Int_t &why)
+{
+  /// Look up the selection of a candidate for a given cut configuration
+
+  if(!CheckEvent()) return kFALSE;
+  fNLookups++;
+  std::map<ULong64_t,Long64_t>::const_iterator it=fSelections.find(SelectionKey(candHash,cutsHash,level));
+  if(it==fSelections.end()) return kFALSE;
+  fNHits++;
+  ULong64_t packed=(ULong64_t)it->second;
+  result =(Short_t)(packed&0xffff);
+  selCuts=(Short_t)((packed>>16)&0xffff);
+  selPID =(Short_t)((packed>>32)&0xffff);
+  why    =(Short_t)((packed>>48)&0xffff);
+  return kTRUE;
+}
+//--------------------------------------------------------------------------
+void AliHFCandidateCache::SetSelection(UInt_t candHash,UInt_t cutsHash,Int_t level,
+				       Int_t result,Int_t selCuts,Int_t selPID,Int_t why)
+{
+  /// Store the selection of a candidate for a given cut configuration,
+  /// together with the side products (cut and PID outcome, rejection reason)
+
+  if(!CheckEvent()) return;
+  ULong64_t packed=((ULong64_t)(UShort_t)result) |
+    ((ULong64_t)(UShort_t)selCuts<<16) |
+    ((ULong64_t)(UShort_t)selPID<<32) |
+    ((ULong64_t)(UShort_t)why<<48);
+  fSelections[SelectionKey(candHash,cutsHash,level)]=(Long64_t)packed;
+}
+//--------------------------------------------------------------------------
+Bool_t AliHFCandidateCache::GetCutVars(UInt_t candHash,UInt_t varsHash,Float_t *vars,Int_t nvars)
+{
+  /// Look up the topological variables of a candidate
+
+  if(!CheckEvent()) return kFALSE;
+  fNLookups++;
+  std::map<ULong64_t,std::vector<Float_t> >::const_iterator it=fCutVars.find(SelectionKey(candHash,varsHash,nvars));
+  if(it==fCutVars.end() || (Int_t)it->second.size()!=nvars) return kFALSE;
+  fNHits++;
+  for(Int_t i=0; i<nvars; i++) vars[i]=it->second[i];
+  return kTRUE;
+}
+//--------------------------------------------------------------------------
+void AliHFCandidateCache::SetCutVars(UInt_t candHash,UInt_t varsHash,const Float_t *vars,Int_t nvars)
+{
+  /// Store the topological variables of a candidate
+  if(!CheckEvent()) return;
+  fCutVars[SelectionKey(candHash,varsHash,nvars)].assign(vars,vars+nvars);
+}
+//--------------------------------------------------------------------------
+Bool_t AliHFCandidateCache::GetnSigma(const AliVTrack *track,Int_t det,Int_t species,Double_t &nsigma)
+{
+  /// Look up the PID nsigma of a track
+
+  if(!CheckEvent()) return kFALSE;
+  fNLookups++;
+  std::map<ULong64_t,Double_t>::const_iterator it=fnSigma.find(TrackKey(track,det,species));
+  if(it==fnSigma.end()) return kFALSE;
+  fNHits++;
+  nsigma=it->second;
+  return kTRUE;
+}
+//--------------------------------------------------------------------------
+void AliHFCandidateCache::SetnSigma(const AliVTrack *track,Int_t det,Int_t species,Double_t nsigma)
+{
+  /// Store the PID nsigma of a track
+  if(!CheckEvent()) return;
+  fnSigma[TrackKey(track,det,species)]=nsigma;
+}
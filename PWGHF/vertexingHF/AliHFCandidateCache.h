@@ -0,0 +1,83 @@
+#ifndef ALIHFCANDIDATECACHE_H
+#define ALIHFCANDIDATECACHE_H
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/* $Id$ */
+
+//***********************************************************
+/// \class Class AliHFCandidateCache
+/// \brief Per-event cache of HF candidate selections shared by all wagons
+///
+/// Holds, for the event being processed by the analysis manager, the
+/// outcome of AliRDHFCuts::IsSelected per candidate and cut configuration,
+/// the topological variables per candidate and cut class and the PID
+/// nsigma per track and species. The cache is a process-wide singleton
+/// invalidated whenever the input handler moves to a new entry, so that
+/// tasks attached to the same train re-use the evaluations of the wagons
+/// that ran before them.
+//***********************************************************
+
+#include <map>
+#include <vector>
+#include <TObject.h>
+
+class AliVEvent;
+class AliVTrack;
+class AliAODRecoDecayHF;
+
+class AliHFCandidateCache : public TObject
+{
+ public:
+
+  enum EPIDDetector {kITS,kTPC,kTOF};
+
+  static AliHFCandidateCache* Instance();
+  virtual ~AliHFCandidateCache() {}
+
+  Bool_t CheckEvent();
+  void   Reset();
+
+  static UInt_t CandidateHash(const AliAODRecoDecayHF *d);
+
+  Bool_t GetSelection(UInt_t candHash,UInt_t cutsHash,Int_t level,
+		      Int_t &result,Int_t &selCuts,Int_t &selPID,Int_t &why);
+  void   SetSelection(UInt_t candHash,UInt_t cutsHash,Int_t level,
+		      Int_t result,Int_t selCuts,Int_t selPID,Int_t why);
+
+  Bool_t GetCutVars(UInt_t candHash,UInt_t varsHash,Float_t *vars,Int_t nvars);
+  void   SetCutVars(UInt_t candHash,UInt_t varsHash,const Float_t *vars,Int_t nvars);
+
+  Bool_t GetnSigma(const AliVTrack *track,Int_t det,Int_t species,Double_t &nsigma);
+  void   SetnSigma(const AliVTrack *track,Int_t det,Int_t species,Double_t nsigma);
+
+  Long64_t GetNLookups() const {return fNLookups;}
+  Long64_t GetNHits() const {return fNHits;}
+
+ private:
+
+  AliHFCandidateCache();
+  AliHFCandidateCache(const AliHFCandidateCache& source);
+  AliHFCandidateCache& operator=(const AliHFCandidateCache& source);
+
+  static ULong64_t SelectionKey(UInt_t candHash,UInt_t cutsHash,Int_t level)
+    {return ((ULong64_t)candHash<<32) | (UInt_t)(cutsHash+0x9e3779b9*(UInt_t)(level+1));}
+  static ULong64_t TrackKey(const AliVTrack *track,Int_t det,Int_t species)
+    {return ((ULong64_t)(ULong_t)track<<6) | ((ULong64_t)(det&0x3)<<4) | (ULong64_t)(species&0xf);}
+
+  static AliHFCandidateCache* fgInstance; /// singleton instance
+
+  const AliVEvent* fEvent; //!<! event the cache refers to
+  Long64_t fEntry;         //!<! analysis manager entry the cache refers to
+  Long64_t fNLookups;      //!<! number of lookups
+  Long64_t fNHits;         //!<! number of successful lookups
+  std::map<ULong64_t,Long64_t> fSelections;               //!<! packed selection results
+  std::map<ULong64_t,std::vector<Float_t> > fCutVars;     //!<! topological variables
+  std::map<ULong64_t,Double_t> fnSigma;                   //!<! PID nsigma
+
+  /// \cond CLASSIMP
+  ClassDef(AliHFCandidateCache,1); /// per-event cache of HF candidate selections
+  /// \endcond
+};
+
+#endif
@@ -0,0 +1,357 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/* $Id$ */
+
+//----------------------------------------------------------------------------
+//  Lightweight DCA-based secondary vertex fitter for HF candidates.
+//  Alternative to AliVertexerTracks and AliKFVertex in
+//  AliAnalysisVertexingHF::ReconstructSecondaryVertex
+//----------------------------------------------------------------------------
+#include <TMath.h>
+#include <TObjArray.h>
+#include "AliExternalTrackParam.h"
+#include "AliHFDCAFitter.h"
+
+/// \cond CLASSIMP
+ClassImp(AliHFDCAFitter);
+/// \endcond
+
+//----------------------------------------------------------------------------
+AliHFDCAFitter::AliHFDCAFitter():
+TObject(),
+fMaxIterations(20),
+fTolerance(1.e-4),
+fMaxDCA(1.),
+fMaxStep(5.),
+fNProngs(0),
+fNIterations(0),
+fChi2(0.),
+fDispersion(0.)
+{
+  /// Default constructor
+  for(Int_t i=0; i<kMaxProngs; i++) fProngX[i]=0.;
+  for(Int_t i=0; i<3; i++) fVertex[i]=0.;
+  for(Int_t i=0; i<6; i++) fCovariance[i]=0.;
+}
+//----------------------------------------------------------------------------
+Bool_t AliHFDCAFitter::Fit(const TObjArray *trkArray, Double_t bzkG, const Double_t *seed)
+{
+  /// Fit the vertex of the tracks stored in trkArray
+  /// (AliESDtrack, AliExternalTrackParam or AliNeutralTrackParam)
+
+  Int_t nTrks = trkArray->GetEntriesFast();
+  if(nTrks<2 || nTrks>kMaxProngs) return kFALSE;
+  const AliExternalTrackParam *trk[kMaxProngs];
+  for(Int_t i=0; i<nTrks; i++) trk[i]=(const AliExternalTrackParam*)trkArray->At(i);
+
+  return Fit(trk,nTrks,bzkG,seed);
+}
+//----------------------------------------------------------------------------
+Bool_t AliHFDCAFitter::Fit(const AliExternalTrackParam **trk, Int_t nTrks, Double_t bzkG, const Double_t *seed)
+{
+  /// Fit the vertex of nTrks tracks. The optional seed (e.g. the primary
+  /// vertex) is used only if the helix intersection cannot be computed
+
+  fNProngs=0;
+  fNIterations=0;
+  if(nTrks<2 || nTrks>kMaxProngs) return kFALSE;
+  for(Int_t i=0; i<nTrks; i++) if(!trk[i]) return kFALSE;
+
+  // seed from the analytic helix intersection of the first two prongs
+  Double_t start[3];
+  if(!SeedFromHelices(trk[0],trk[1],bzkG,start)) {
+    if(seed) {
+      for(Int_t j=0; j<3; j++) start[j]=seed[j];
+    } else {
+      for(Int_t j=0; j<3; j++) start[j]=0.;
+      for(Int_t i=0; i<nTrks; i++) {
+	Double_t xyz[3];
+	trk[i]->GetXYZ(xyz);
+	for(Int_t j=0; j<3; j++) start[j]+=xyz[j]/nTrks;
+      }
+    }
+  }
+  for(Int_t i=0; i<nTrks; i++) fProngX[i]=LocalX(trk[i],start);
+
+  // Gauss-Newton minimization of sum_i |r_i(x_i) - <r>|^2 over the prong X
+  Double_t r[kMaxProngs][3], d[kMaxProngs][3], vtx[3];
+  Double_t hess[kMaxProngs*kMaxProngs], grad[kMaxProngs];
+  Double_t invN=1./nTrks;
+  Bool_t converged=kFALSE;
+  while(fNIterations<fMaxIterations) {
+    fNIterations++;
+    for(Int_t i=0; i<nTrks; i++) {
+      if(!PointAndDirection(trk[i],fProngX[i],bzkG,r[i],d[i])) return kFALSE;
+    }
+    for(Int_t j=0; j<3; j++) {
+      vtx[j]=0.;
+      for(Int_t i=0; i<nTrks; i++) vtx[j]+=r[i][j]*invN;
+    }
+    for(Int_t i=0; i<nTrks; i++) {
+      grad[i]=-((r[i][0]-vtx[0])*d[i][0]+(r[i][1]-vtx[1])*d[i][1]+(r[i][2]-vtx[2])*d[i][2]);
+      for(Int_t k=0; k<nTrks; k++) {
+	Double_t dd=d[i][0]*d[k][0]+d[i][1]*d[k][1]+d[i][2]*d[k][2];
+	hess[i*nTrks+k]=dd*((i==k ? 1. : 0.)-invN);
+      }
+    }
+    if(!SolveLinear(hess,grad,nTrks)) return kFALSE;
+    Double_t maxShift=0.;
+    for(Int_t i=0; i<nTrks; i++) maxShift=TMath::Max(maxShift,TMath::Abs(grad[i]));
+    Double_t scale = maxShift>fMaxStep ? fMaxStep/maxShift : 1.;
+    for(Int_t i=0; i<nTrks; i++) fProngX[i]+=scale*grad[i];
+    if(maxShift<fTolerance) { converged=kTRUE; break; }
+  }
+  if(!converged) return kFALSE;
+
+  // DCA of the prongs from their barycenter
+  for(Int_t i=0; i<nTrks; i++) {
+    if(!PointAndDirection(trk[i],fProngX[i],bzkG,r[i],d[i])) return kFALSE;
+  }
+  for(Int_t j=0; j<3; j++) {
+    vtx[j]=0.;
+    for(Int_t i=0; i<nTrks; i++) vtx[j]+=r[i][j]*invN;
+  }
+  fDispersion=0.;
+  for(Int_t i=0; i<nTrks; i++) {
+    Double_t dist=TMath::Sqrt((r[i][0]-vtx[0])*(r[i][0]-vtx[0])+
+			      (r[i][1]-vtx[1])*(r[i][1]-vtx[1])+
+			      (r[i][2]-vtx[2])*(r[i][2]-vtx[2]));
+    if(fMaxDCA>0. && dist>fMaxDCA) return kFALSE;
+    fDispersion+=dist*invN;
+  }
+
+  fNProngs=nTrks;
+  if(!ComputeWeightedVertex(trk,bzkG)) {
+    fNProngs=0;
+    return kFALSE;
+  }
+  return kTRUE;
+}
+//----------------------------------------------------------------------------
+Bool_t AliHFDCAFitter::SeedFromHelices(const AliExternalTrackParam *t0, const AliExternalTrackParam *t1,
+				       Double_t bzkG, Double_t seed[3]) const
+{
+  /// Closed-form intersection of the trajectories of two tracks in the
+  /// transverse plane (circle-circle, circle-line or line-line). Among the
+  /// two solutions, the one with the smallest z difference is taken
+
+  const AliExternalTrackParam *t[2]={t0,t1};
+  Double_t cen[2][2], rad[2], pnt[2][2], dir[2][2];
+  Bool_t straight[2];
+  for(Int_t i=0; i<2; i++) {
+    Double_t xyz[3];
+    t[i]->GetXYZ(xyz);
+    Double_t phi=t[i]->Phi();
+    Double_t crv=t[i]->GetC(bzkG);
+    pnt[i][0]=xyz[0]; pnt[i][1]=xyz[1];
+    dir[i][0]=TMath::Cos(phi); dir[i][1]=TMath::Sin(phi);
+    straight[i]=(TMath::Abs(crv)<1.e-7);
+    if(!straight[i]) {
+      // dphi/ds = C, the center is on the left of the direction for C>0
+      cen[i][0]=xyz[0]-dir[i][1]/crv;
+      cen[i][1]=xyz[1]+dir[i][0]/crv;
+      rad[i]=1./TMath::Abs(crv);
+    }
+  }
+
+  Double_t cand[2][2];
+  Int_t nCand=0;
+  if(!straight[0] && !straight[1]) {
+    Double_t dx=cen[1][0]-cen[0][0], dy=cen[1][1]-cen[0][1];
+    Double_t dist=TMath::Sqrt(dx*dx+dy*dy);
+    if(dist<1.e-9) return kFALSE;
+    Double_t ux=dx/dist, uy=dy/dist;
+    if(dist>rad[0]+rad[1] || dist<TMath::Abs(rad[0]-rad[1])) {
+      // no crossing: middle point of the closest approach of the circles
+      Double_t s0=rad[0], s1=-rad[1];
+      if(dist<TMath::Abs(rad[0]-rad[1])) {
+	s0 = rad[0]>rad[1] ? rad[0] : -rad[0];
+	s1 = rad[0]>rad[1] ? rad[1] : -rad[1];
+      }
+      cand[0][0]=0.5*(cen[0][0]+s0*ux+cen[1][0]+s1*ux);
+      cand[0][1]=0.5*(cen[0][1]+s0*uy+cen[1][1]+s1*uy);
+      nCand=1;
+    } else {
+      Double_t a=(rad[0]*rad[0]-rad[1]*rad[1]+dist*dist)/(2.*dist);
+      Double_t h=TMath::Sqrt(TMath::Max(0.,rad[0]*rad[0]-a*a));
+      for(Int_t k=0; k<2; k++) {
+	Double_t sgn = k==0 ? 1. : -1.;
+	cand[k][0]=cen[0][0]+a*ux-sgn*h*uy;
+	cand[k][1]=cen[0][1]+a*uy+sgn*h*ux;
+      }
+      nCand=2;
+    }
+  } else if(straight[0] && straight[1]) {
+    Double_t det=dir[0][0]*dir[1][1]-dir[0][1]*dir[1][0];
+    if(TMath::Abs(det)<1.e-9) return kFALSE;
+    Double_t dx=pnt[1][0]-pnt[0][0], dy=pnt[1][1]-pnt[0][1];
+    Double_t s=(dx*dir[1][1]-dy*dir[1][0])/det;
+    cand[0][0]=pnt[0][0]+s*dir[0][0];
+    cand[0][1]=pnt[0][1]+s*dir[0][1];
+    nCand=1;
+  } else {
+    Int_t il = straight[0] ? 0 : 1;
+    Int_t ic = 1-il;
+    Double_t px=pnt[il][0]-cen[ic][0], py=pnt[il][1]-cen[ic][1];
+    Double_t b=dir[il][0]*px+dir[il][1]*py;
+    Double_t disc=b*b-(px*px+py*py-rad[ic]*rad[ic]);
+    if(disc<0.) {
+      // no crossing: middle point between the line and the circle
+      Double_t lx=pnt[il][0]-b*dir[il][0], ly=pnt[il][1]-b*dir[il][1];
+      Double_t dx=lx-cen[ic][0], dy=ly-cen[ic][1];
+      Double_t dist=TMath::Sqrt(dx*dx+dy*dy);
+      if(dist<1.e-9) return kFALSE;
+      cand[0][0]=0.5*(lx+cen[ic][0]+rad[ic]*dx/dist);
+      cand[0][1]=0.5*(ly+cen[ic][1]+rad[ic]*dy/dist);
+      nCand=1;
+    } else {
+      Double_t sq=TMath::Sqrt(disc);
+      for(Int_t k=0; k<2; k++) {
+	Double_t s = -b+(k==0 ? sq : -sq);
+	cand[k][0]=pnt[il][0]+s*dir[il][0];
+	cand[k][1]=pnt[il][1]+s*dir[il][1];
+      }
+      nCand=2;
+    }
+  }
+
+  Double_t bestDz=1.e30;
+  Bool_t found=kFALSE;
+  for(Int_t k=0; k<nCand; k++) {
+    Double_t xy[3]={cand[k][0],cand[k][1],0.};
+    Double_t r0[3], r1[3];
+    if(!t0->GetXYZAt(LocalX(t0,xy),bzkG,r0)) continue;
+    if(!t1->GetXYZAt(LocalX(t1,xy),bzkG,r1)) continue;
+    Double_t dz=TMath::Abs(r0[2]-r1[2]);
+    if(dz<bestDz) {
+      bestDz=dz;
+      seed[0]=xy[0];
+      seed[1]=xy[1];
+      seed[2]=0.5*(r0[2]+r1[2]);
+      found=kTRUE;
+    }
+  }
+  return found;
+}
+//----------------------------------------------------------------------------
+Bool_t AliHFDCAFitter::PointAndDirection(const AliExternalTrackParam *trk, Double_t x, Double_t bzkG,
+					 Double_t r[3], Double_t d[3]) const
+{
+  /// Global position of the track at local X and its derivative dr/dX
+
+  Double_t p[3];
+  if(!trk->GetXYZAt(x,bzkG,r)) return kFALSE;
+  if(!trk->GetPxPyPzAt(x,bzkG,p)) return kFALSE;
+  Double_t alpha=trk->GetAlpha();
+  Double_t pxLoc=p[0]*TMath::Cos(alpha)+p[1]*TMath::Sin(alpha);
+  if(TMath::Abs(pxLoc)<1.e-9) return kFALSE;
+  for(Int_t j=0; j<3; j++) d[j]=p[j]/pxLoc;
+  return kTRUE;
+}
+//----------------------------------------------------------------------------
+Double_t AliHFDCAFitter::LocalX(const AliExternalTrackParam *trk, const Double_t xyz[3])
+{
+  /// X coordinate of a global point in the track reference frame
+  Double_t alpha=trk->GetAlpha();
+  return xyz[0]*TMath::Cos(alpha)+xyz[1]*TMath::Sin(alpha);
+}
+//----------------------------------------------------------------------------
+Bool_t AliHFDCAFitter::SolveLinear(Double_t *a, Double_t *b, Int_t n)
+{
+  /// Solve a*x=b (a is n*n row-major) with partial pivoting, x returned in b
+  for(Int_t col=0; col<n; col++) {
+    Int_t piv=col;
+    for(Int_t row=col+1; row<n; row++) {
+      if(TMath::Abs(a[row*n+col])>TMath::Abs(a[piv*n+col])) piv=row;
+    }
+    if(TMath::Abs(a[piv*n+col])<1.e-15) return kFALSE;
+    if(piv!=col) {
+      for(Int_t k=0; k<n; k++) {
+	Double_t tmp=a[col*n+k]; a[col*n+k]=a[piv*n+k]; a[piv*n+k]=tmp;
+      }
+      Double_t tmp=b[col]; b[col]=b[piv]; b[piv]=tmp;
+    }
+    for(Int_t row=col+1; row<n; row++) {
+      Double_t f=a[row*n+col]/a[col*n+col];
+      for(Int_t k=col; k<n; k++) a[row*n+k]-=f*a[col*n+k];
+      b[row]-=f*b[col];
+    }
+  }
+  for(Int_t row=n-1; row>=0; row--) {
+    for(Int_t k=row+1; k<n; k++) b[row]-=a[row*n+k]*b[k];
+    b[row]/=a[row*n+row];
+  }
+  return kTRUE;
+}
+//----------------------------------------------------------------------------
+Bool_t AliHFDCAFitter::ComputeWeightedVertex(const AliExternalTrackParam **trk, Double_t bzkG)
+{
+  /// Vertex and covariance from the prong points at the fitted X, weighted
+  /// with the track y-z errors projected on the plane transverse to the
+  /// track direction. The errors at the track reference X are used, which is
+  /// accurate enough for the short propagation lengths of HF decays
+
+  Double_t r[kMaxProngs][3], d[kMaxProngs][3], w[kMaxProngs][6];
+  Double_t sumW[6]={0.,0.,0.,0.,0.,0.}, sumWr[3]={0.,0.,0.};
+  for(Int_t i=0; i<fNProngs; i++) {
+    if(!PointAndDirection(trk[i],fProngX[i],bzkG,r[i],d[i])) return kFALSE;
+    // d = p/pxLoc, so that the transverse direction and cos(phiLoc) follow
+    Double_t dt=TMath::Sqrt(d[i][0]*d[i][0]+d[i][1]*d[i][1]);
+    if(dt<1.e-9) return kFALSE;
+    Double_t cphiLoc=1./dt;
+    Double_t ux=-d[i][1]/dt, uy=d[i][0]/dt;
+    Double_t spp=trk[i]->GetSigmaY2()*cphiLoc*cphiLoc;
+    Double_t spz=trk[i]->GetSigmaZY()*cphiLoc;
+    Double_t szz=trk[i]->GetSigmaZ2();
+    Double_t det=spp*szz-spz*spz;
+    if(det<=0.) return kFALSE;
+    Double_t wpp=szz/det, wpz=-spz/det, wzz=spp/det;
+    w[i][0]=wpp*ux*ux;
+    w[i][1]=wpp*ux*uy;
+    w[i][2]=wpp*uy*uy;
+    w[i][3]=wpz*ux;
+    w[i][4]=wpz*uy;
+    w[i][5]=wzz;
+    for(Int_t k=0; k<6; k++) sumW[k]+=w[i][k];
+    sumWr[0]+=w[i][0]*r[i][0]+w[i][1]*r[i][1]+w[i][3]*r[i][2];
+    sumWr[1]+=w[i][1]*r[i][0]+w[i][2]*r[i][1]+w[i][4]*r[i][2];
+    sumWr[2]+=w[i][3]*r[i][0]+w[i][4]*r[i][1]+w[i][5]*r[i][2];
+  }
+
+  // invert the symmetric 3x3 weight matrix (xx,xy,yy,xz,yz,zz)
+  Double_t a=sumW[0], b=sumW[1], c=sumW[2], e=sumW[3], f=sumW[4], g=sumW[5];
+  Double_t i00=c*g-f*f, i01=e*f-b*g, i02=b*f-c*e;
+  Double_t i11=a*g-e*e, i12=b*e-a*f, i22=a*c-b*b;
+  Double_t det=a*i00+b*i01+e*i02;
+  if(TMath::Abs(det)<1.e-30) return kFALSE;
+  fCovariance[0]=i00/det;
+  fCovariance[1]=i01/det;
+  fCovariance[2]=i11/det;
+  fCovariance[3]=i02/det;
+  fCovariance[4]=i12/det;
+  fCovariance[5]=i22/det;
+  fVertex[0]=fCovariance[0]*sumWr[0]+fCovariance[1]*sumWr[1]+fCovariance[3]*sumWr[2];
+  fVertex[1]=fCovariance[1]*sumWr[0]+fCovariance[2]*sumWr[1]+fCovariance[4]*sumWr[2];
+  fVertex[2]=fCovariance[3]*sumWr[0]+fCovariance[4]*sumWr[1]+fCovariance[5]*sumWr[2];
+
+  fChi2=0.;
+  for(Int_t i=0; i<fNProngs; i++) {
+    Double_t dx=r[i][0]-fVertex[0], dy=r[i][1]-fVertex[1], dz=r[i][2]-fVertex[2];
+    fChi2+=w[i][0]*dx*dx+w[i][2]*dy*dy+w[i][5]*dz*dz
+      +2.*(w[i][1]*dx*dy+w[i][3]*dx*dz+w[i][4]*dy*dz);
+  }
+  return kTRUE;
+}
@@ -0,0 +1,86 @@
+#ifndef ALIHFDCAFITTER_H
+#define ALIHFDCAFITTER_H
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/* $Id$ */
+
+//-------------------------------------------------------------------------
+/// \class AliHFDCAFitter
+/// \brief Lightweight secondary vertex fitter for 2-, 3- and 4-prong decays
+///
+/// The vertex is found by minimizing the sum of the squared distances of the
+/// prong trajectories from their barycenter: the seed is obtained from the
+/// analytic intersection of the helices of the first two prongs in the
+/// transverse plane, then the local X of each prong is refined with
+/// Gauss-Newton iterations. The final vertex and its covariance matrix are
+/// computed by weighting the prong positions with their track errors in the
+/// plane transverse to the track direction.
+/// No heap allocation is done during the fit: the prongs are only accessed
+/// through const methods and all the work arrays live on the stack.
+//-------------------------------------------------------------------------
+
+#include <TObject.h>
+
+class TObjArray;
+class AliExternalTrackParam;
+
+class AliHFDCAFitter : public TObject {
+ public:
+
+  enum { kMaxProngs = 4 };
+
+  AliHFDCAFitter();
+  virtual ~AliHFDCAFitter() {}
+
+  Bool_t Fit(const TObjArray *trkArray, Double_t bzkG, const Double_t *seed=0x0);
+  Bool_t Fit(const AliExternalTrackParam **trk, Int_t nTrks, Double_t bzkG, const Double_t *seed=0x0);
+
+  void SetMaxIterations(Int_t n=20) { fMaxIterations=n; }
+  void SetTolerance(Double_t tol=1.e-4) { fTolerance=tol; }
+  void SetMaxDCA(Double_t dca=1.) { fMaxDCA=dca; }
+  void SetMaxStep(Double_t step=5.) { fMaxStep=step; }
+  Int_t GetMaxIterations() const { return fMaxIterations; }
+  Double_t GetTolerance() const { return fTolerance; }
+  Double_t GetMaxDCA() const { return fMaxDCA; }
+  Double_t GetMaxStep() const { return fMaxStep; }
+
+  /// results of the last successful fit
+  void GetXYZ(Double_t pos[3]) const { for(Int_t i=0; i<3; i++) pos[i]=fVertex[i]; }
+  void GetCovMatrix(Double_t cov[6]) const { for(Int_t i=0; i<6; i++) cov[i]=fCovariance[i]; }
+  Double_t GetChi2() const { return fChi2; }
+  Double_t GetChi2toNDF() const { Int_t ndf=2*fNProngs-3; return ndf>0 ? fChi2/ndf : -1.; }
+  Double_t GetDispersion() const { return fDispersion; }
+  Int_t GetNProngs() const { return fNProngs; }
+  Int_t GetNIterations() const { return fNIterations; }
+  Double_t GetProngX(Int_t i) const { return fProngX[i]; }
+
+ private:
+
+  Bool_t SeedFromHelices(const AliExternalTrackParam *t0, const AliExternalTrackParam *t1,
+                         Double_t bzkG, Double_t seed[3]) const;
+  Bool_t PointAndDirection(const AliExternalTrackParam *trk, Double_t x, Double_t bzkG,
+                           Double_t r[3], Double_t d[3]) const;
+  static Double_t LocalX(const AliExternalTrackParam *trk, const Double_t xyz[3]);
+  static Bool_t SolveLinear(Double_t *a, Double_t *b, Int_t n);
+  Bool_t ComputeWeightedVertex(const AliExternalTrackParam **trk, Double_t bzkG);
+
+  Int_t    fMaxIterations; /// max. number of Newton iterations
+  Double_t fTolerance;     /// convergence criterion on the prong X shift (cm)
+  Double_t fMaxDCA;        /// max. distance of a prong from the vertex (cm)
+  Double_t fMaxStep;       /// max. X shift per iteration (cm)
+
+  Int_t    fNProngs;                 //! number of prongs of the last fit
+  Int_t    fNIterations;             //! iterations used in the last fit
+  Double_t fProngX[kMaxProngs];      //! local X of the prongs at the vertex
+  Double_t fVertex[3];               //! fitted vertex position
+  Double_t fCovariance[6];           //! fitted vertex covariance matrix
+  Double_t fChi2;                    //! chi2 of the weighted vertex
+  Double_t fDispersion;              //! mean distance of the prongs from the vertex
+
+  /// \cond CLASSIMP
+  ClassDef(AliHFDCAFitter,1); // Lightweight secondary vertex fitter
+  /// \endcond
+};
+
+#endif
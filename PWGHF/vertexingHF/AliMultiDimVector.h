@@ -78,6 +78,7 @@ class AliMultiDimVector :  public TNamed{
     else return 0x0;
   }
   ULong64_t* GetGlobalAddressesAboveCuts(const Float_t *values, Int_t ptbin, Int_t& nVals) const;
+  Int_t     GetNCellsAboveCuts(const Float_t *values) const;
   Bool_t    GetGreaterThan(Int_t iVar) const {return fGreaterThan[iVar];}
 
   void SetElement(ULong64_t globadd,Float_t val) {fVett[globadd]=val;}
@@ -97,7 +98,10 @@ class AliMultiDimVector :  public TNamed{
 
   void Fill(Float_t* values, Int_t ptbin);
   void FillAndIntegrate(Float_t* values, Int_t ptbin);
+  void FillAndIntegrate(Int_t nCand, const Float_t* values, const Int_t* ptbins);
   void Integrate();
+  void IntegrateCells(Float_t *vett) const;
+  void IntegrateCells(TH1F **hists) const;
 
   void Reset(){
     for(ULong64_t i=0; i<fNTotCells; i++) fVett[i]=0.;
@@ -131,6 +135,7 @@ class AliMultiDimVector :  public TNamed{
   void GetIntegrationLimits(Int_t iVar, Int_t iCell, Int_t& minbin, Int_t& maxbin) const;
   void GetFillRange(Int_t iVar, Int_t iCell, Int_t& minbin, Int_t& maxbin) const;
   Float_t   CountsAboveCell(ULong64_t globadd) const;
+  ULong64_t GetCellStride(Int_t iVar) const;
 
   //void SetMinLimits(Int_t nvar, Float_t* minlim);
   //void SetMaxLimits(Int_t nvar, Float_t* maxlim);
@@ -35,6 +35,7 @@
 #include "AliESDtrackCuts.h"
 #include "AliCentrality.h"
 #include "AliAODRecoDecayHF.h"
+#include "AliHFCandidateCache.h"
 #include "AliAnalysisVertexingHF.h"
 #include "AliAODMCHeader.h"
 #include "AliAODMCParticle.h"
@@ -51,6 +52,7 @@
 #include <TF1.h>
 #include <TFile.h>
 #include <TKey.h>
+#include <TBufferFile.h>
 
 using std::cout;
 using std::endl;
@@ -125,7 +127,9 @@ fCutGeoNcrNclLength(130.),
 fCutGeoNcrNclGeom1Pt(1.5),
 fCutGeoNcrNclFractionNcr(0.85),
 fCutGeoNcrNclFractionNcl(0.7),
-fUseV0ANDSelectionOffline(kFALSE)
+fUseV0ANDSelectionOffline(kFALSE),
+fUseSelectionCache(kFALSE),
+fConfigHash(0)
 {
   //
   // Default Constructor
@@ -198,7 +202,9 @@ AliRDHFCuts::AliRDHFCuts(const AliRDHFCuts &source) :
   fCutGeoNcrNclGeom1Pt(source.fCutGeoNcrNclGeom1Pt),
   fCutGeoNcrNclFractionNcr(source.fCutGeoNcrNclFractionNcr),
   fCutGeoNcrNclFractionNcl(source.fCutGeoNcrNclFractionNcl),
-  fUseV0ANDSelectionOffline(source.fUseV0ANDSelectionOffline)
+  fUseV0ANDSelectionOffline(source.fUseV0ANDSelectionOffline),
+  fUseSelectionCache(source.fUseSelectionCache),
+  fConfigHash(0)
 {
   //
   // Copy constructor
@@ -298,6 +304,8 @@ AliRDHFCuts &AliRDHFCuts::operator=(const AliRDHFCuts &source)
   fCutGeoNcrNclFractionNcr=source.fCutGeoNcrNclFractionNcr;
   fCutGeoNcrNclFractionNcl=source.fCutGeoNcrNclFractionNcl;
   fUseV0ANDSelectionOffline=source.fUseV0ANDSelectionOffline;
+  fUseSelectionCache=source.fUseSelectionCache;
+  fConfigHash=0;
 
   PrintAll();
 
@@ -455,6 +463,7 @@ void AliRDHFCuts::SetupPID(AliVEvent *event) {
       fPidHF->SetPidResponse(pidResp);
     }
     if(fPidHF->GetUseCombined()) fPidHF->SetUpCombinedPID();
+    fPidHF->SetUseNsigmaCache(fUseSelectionCache);
     if(fPidHF->GetOldPid()) {
 
       Bool_t isMC=kFALSE;
@@ -1254,6 +1263,106 @@ void AliRDHFCuts::GetVarPtIndex(Int_t iGlob, Int_t& iVar, Int_t& iPtBin) const {
   return;
 }
 
+//---------------------------------------------------------------------------
+UInt_t AliRDHFCuts::GetConfigHash() {
+  //
+  // Hash of the full cut configuration, obtained from the streamed object.
+  // Name, title and the per-event outcome members are excluded, so that
+  // identically configured objects of different tasks share the hash
+  //
+  if(fConfigHash) return fConfigHash;
+
+  TString name=GetName(), title=GetTitle();
+  Int_t why=fWhyRejection, selCuts=fIsSelectedCuts, selPID=fIsSelectedPID;
+  UInt_t evRej=fEvRejectionBits;
+  SetNameTitle("","");
+  fWhyRejection=0; fIsSelectedCuts=0; fIsSelectedPID=0; fEvRejectionBits=0;
+
+  TBufferFile buf(TBuffer::kWrite);
+  buf.WriteObjectAny(this,IsA());
+  fConfigHash=TString::Hash(buf.Buffer(),buf.Length());
+  if(fConfigHash==0) fConfigHash=1;
+
+  SetNameTitle(name.Data(),title.Data());
+  fWhyRejection=why; fIsSelectedCuts=selCuts; fIsSelectedPID=selPID;
+  fEvRejectionBits=evRej;
+
+  return fConfigHash;
+}
+//---------------------------------------------------------------------------
+UInt_t AliRDHFCuts::GetSelectionHash() {
+  //
+  // Hash used as key of the selection cache: the configuration hash is
+  // computed once, the switches which can be changed between two calls
+  // (e.g. SetUsePID toggled around IsSelected) are added at each call.
+  // The PID configuration is streamed with the cut object and is part of
+  // the configuration hash
+  //
+  Double_t state[11];
+  Int_t n=0;
+  state[n++]=GetConfigHash();
+  state[n++]=fUsePID;
+  state[n++]=fRemoveDaughtersFromPrimary;
+  state[n++]=fUseMCVertex;
+  state[n++]=fKinkReject;
+  state[n++]=fUseAOD049;
+  state[n++]=fUseTrackSelectionWithFilterBits;
+  state[n++]=fOptPileup;
+  state[n++]=fMinPtCand;
+  state[n++]=fMaxPtCand;
+  state[n++]=fMaxRapidityCand;
+  UInt_t hash=TString::Hash(state,n*sizeof(Double_t));
+  return hash ? hash : 1;
+}
+//---------------------------------------------------------------------------
+Int_t AliRDHFCuts::IsSelectedCached(TObject* obj,Int_t selectionLevel,AliAODEvent* aod) {
+  //
+  // IsSelected with look-up in the per-event AliHFCandidateCache:
+  // a candidate already evaluated in this event by an identically
+  // configured cut object is not selected again
+  //
+  AliAODRecoDecayHF *d=dynamic_cast<AliAODRecoDecayHF*>(obj);
+  AliHFCandidateCache *cache=AliHFCandidateCache::Instance();
+  if(!fUseSelectionCache || !d || !cache->CheckEvent()) return IsSelected(obj,selectionLevel,aod);
+
+  // the outcome may depend on the event (e.g. primary vertex recomputation)
+  Int_t level=2*selectionLevel+(aod ? 1 : 0);
+  UInt_t candHash=AliHFCandidateCache::CandidateHash(d);
+  UInt_t cutsHash=GetSelectionHash();
+  Int_t result=0, selCuts=0, selPID=0, why=0;
+  if(cache->GetSelection(candHash,cutsHash,level,result,selCuts,selPID,why)) {
+    fIsSelectedCuts=selCuts;
+    fIsSelectedPID=selPID;
+    fWhyRejection=why;
+    return result;
+  }
+  result=IsSelected(obj,selectionLevel,aod);
+  cache->SetSelection(candHash,cutsHash,level,result,fIsSelectedCuts,fIsSelectedPID,fWhyRejection);
+  return result;
+}
+//---------------------------------------------------------------------------
+void AliRDHFCuts::GetCutVarsForOptCached(AliAODRecoDecayHF *d,Float_t *vars,Int_t nvars,Int_t *pdgdaughters,AliAODEvent *aod) {
+  //
+  // GetCutVarsForOpt with look-up in the per-event AliHFCandidateCache:
+  // the variables depend on the candidate, on the cut class and on the
+  // cut configuration (e.g. primary vertex recomputation)
+  //
+  AliHFCandidateCache *cache=AliHFCandidateCache::Instance();
+  if(!fUseSelectionCache || !cache->CheckEvent()) {
+    GetCutVarsForOpt(d,vars,nvars,pdgdaughters,aod);
+    return;
+  }
+  Int_t nDau=d->GetNProngs();
+  TString key=ClassName();
+  if(pdgdaughters) for(Int_t i=0; i<nDau; i++) key+=Form("_%d",pdgdaughters[i]);
+  if(aod) key+="_aod";
+  key+=Form("_%u",GetSelectionHash());
+  UInt_t candHash=AliHFCandidateCache::CandidateHash(d);
+  UInt_t varsHash=key.Hash();
+  if(cache->GetCutVars(candHash,varsHash,vars,nvars)) return;
+  GetCutVarsForOpt(d,vars,nvars,pdgdaughters,aod);
+  cache->SetCutVars(candHash,varsHash,vars,nvars);
+}
 //---------------------------------------------------------------------------
 Int_t AliRDHFCuts::PtBin(Double_t pt) const {
   //
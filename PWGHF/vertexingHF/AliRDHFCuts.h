@@ -294,6 +294,18 @@ class AliRDHFCuts : public AliAnalysisCuts
   virtual Int_t IsSelected(TObject* obj,Int_t selectionLevel) = 0;
   virtual Int_t IsSelected(TObject* obj,Int_t selectionLevel,AliAODEvent* /*aod*/)
                 {return IsSelected(obj,selectionLevel);}
+  Int_t IsSelectedCached(TObject* obj,Int_t selectionLevel,AliAODEvent* aod=0x0);
+  void GetCutVarsForOptCached(AliAODRecoDecayHF *d,Float_t *vars,Int_t nvars,Int_t *pdgdaughters,AliAODEvent *aod=0x0);
+  /// Share candidate selections, topological variables and PID nsigmas
+  /// with the other AliRDHFCuts objects of the train (see AliHFCandidateCache)
+  void SetUseSelectionCache(Bool_t opt=kTRUE) {fUseSelectionCache=opt;}
+  Bool_t GetUseSelectionCache() const {return fUseSelectionCache;}
+  UInt_t GetConfigHash();
+  /// to be called if the cuts are changed after the first cached selection
+  void ResetConfigHash() {fConfigHash=0;}
+  /// configuration hash combined with the switches that tasks toggle at run time
+  /// (PID usage, primary vertex treatment, candidate pt/y limits, ...), used as cache key
+  UInt_t GetSelectionHash();
   Int_t PtBin(Double_t pt) const;
   virtual void PrintAll()const;
   void PrintTrigger() const;
@@ -453,10 +465,12 @@ class AliRDHFCuts : public AliAnalysisCuts
   Double_t fCutGeoNcrNclFractionNcr; /// 4th parameter of GeoNcrNcl cut
   Double_t fCutGeoNcrNclFractionNcl; /// 5th parameter of GeoNcrNcl cut
   Bool_t fUseV0ANDSelectionOffline; ///flag to apply V0AND selection offline
+  Bool_t fUseSelectionCache; /// flag to share selections via AliHFCandidateCache
+  UInt_t fConfigHash; //!<! hash of the cut configuration, computed at first use
   
 
   /// \cond CLASSIMP    
-  ClassDef(AliRDHFCuts,40);  /// base class for cuts on AOD reconstructed heavy-flavour decays
+  ClassDef(AliRDHFCuts,41);  /// base class for cuts on AOD reconstructed heavy-flavour decays
   /// \endcond
 };
 
@@ -13,6 +13,7 @@
 #pragma link C++ class AliAODRecoCascadeHF3Prong+;
 #pragma link C++ class AliAODHFUtil+;
 #pragma link C++ class AliAODPidHF+;
+#pragma link C++ class AliHFCandidateCache+;
 #pragma link C++ class AliRDHFCuts+;
 #pragma link C++ class AliVertexingHFUtils+;
 #pragma link C++ class AliHFSystErr+;
@@ -31,6 +32,7 @@
 #pragma link C++ class AliRDHFCutsOmegactoeleOmegafromAODtracks+;
 #pragma link C++ class AliRDHFCutsXicPlustoXiPiPifromAODtracks++;
 #pragma link C++ class AliRDHFCutsXictoeleXifromAODtracks+;
+#pragma link C++ class AliHFDCAFitter+;
 #pragma link C++ class AliAnalysisVertexingHF+;
 #pragma link C++ class AliAnalysisTaskSEVertexingHF+;
 #pragma link C++ class AliAnalysisTaskMEVertexingHF+;
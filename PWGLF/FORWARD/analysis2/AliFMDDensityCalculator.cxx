@@ -401,6 +401,13 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
   // We do not use TArrayD because we do not wont a bounds check 
   // TArrayD etaCache(20*512); // Same number of strips per ring
   // TArrayD phiCache(20*512); // whether it is inner our outer. 
+  Double_t                      stripEta[512];
+  Double_t                      stripCut[512];
+  Float_t                       stripAcc[512];
+  Bool_t                        stripSet[512];
+  Bool_t                        stripFitSet[512];
+  AliFMDCorrELossFit::ELossFit* stripFit[512];
+  UShort_t                      stripN[512];
   
   // --- Loop over detectors -----------------------------------------
   for (UShort_t d=1; d<=3; d++) { 
@@ -430,6 +437,19 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
       // etaCache.Reset(AliESDFMD::kInvalidEta);
       // phiCache.Reset(AliESDFMD::kInvalidEta);
 
+      // --- Per-strip cache of eta dependent quantities -------------
+      // Unless (eta,phi) is re-calculated, the pseudo-rapidity of a
+      // strip is the same in all sectors.  The cut and the energy
+      // loss fit are therefore looked up once per strip in the ring,
+      // and only again if eta changes.  The acceptance correction
+      // only depends on the strip number.
+      for (UShort_t t=0; t<nt; t++) { 
+	stripSet[t]    = false;
+	stripFitSet[t] = false;
+	stripAcc[t]    = (fUsePhiAcceptance == kPhiNoCorrect ? 1 :
+			  AcceptanceCorrection(r,t));
+      }
+
       // --- Loop over sectors and strips ----------------------------
       for (UShort_t s=0; s<ns; s++) { 
 	for (UShort_t t=0; t<nt; t++) {
@@ -485,18 +505,37 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
 
 	  // --- Apply phi corner correction to eloss ----------------
 	  if (fUsePhiAcceptance == kPhiCorrectELoss) 
-	    mult *= AcceptanceCorrection(r,t);
+	    mult *= stripAcc[t];
 
 	  // --- Get the low multiplicity cut ------------------------
 	  Double_t cut  = 1024;
-	  if (eta != AliESDFMD::kInvalidEta) cut = GetMultCut(d, r, eta,false);
+	  Bool_t   etaOK = eta != AliESDFMD::kInvalidEta;
+	  if (etaOK) {
+	    if (!stripSet[t] || stripEta[t] != eta) { 
+	      stripSet[t]    = true;
+	      stripFitSet[t] = false;
+	      stripEta[t]    = eta;
+	      stripCut[t]    = GetMultCut(d, r, eta,false);
+	    }
+	    cut = stripCut[t];
+	  }
 	  else AliWarningF("Eta for FMD%d%c[%02d,%03d] is invalid: %f", 
 			   d, r, s, t, eta);
 
 	  // --- Now caluculate Nch for this strip using fits --------
 	  START_TIMER(timer);
 	  Double_t n   = 0;
-	  if (cut > 0 && mult > cut) n = NParticles(mult,d,r,eta,lowFlux);
+	  if (cut > 0 && mult > cut) { 
+	    if (lowFlux || !etaOK) n = NParticles(mult,d,r,eta,lowFlux);
+	    else { 
+	      if (!stripFitSet[t]) { 
+		stripFitSet[t] = true;
+		FindNParticlesFit(d, r, eta, stripFit[t], stripN[t]);
+	      }
+	      if (stripFit[t]) 
+		n = EvalNParticles(mult, stripFit[t], stripN[t], d, r, eta);
+	    }
+	  }
 	  rh->fELoss->Fill(mult);
 	  // rh->fEvsN->Fill(mult,n);
 	  // rh->fEtaVsN->Fill(eta, n);
@@ -507,7 +546,7 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
 	  // Temporary stuff - remove Correction call 
 	  Double_t c = 1;
 	  if (fUsePhiAcceptance == kPhiCorrectNch) 
-	    c = AcceptanceCorrection(r,t);
+	    c = stripAcc[t];
 	  // Double_t c = Correction(d,r,t,eta,lowFlux);
 	  ADD_TIMER(timer,corrTime);
 	  fCorrections->Fill(c);
@@ -863,21 +902,56 @@ AliFMDDensityCalculator::NParticles(Float_t  mult,
   DGUARD(fDebug, 3, "Calculate Nch in FMD density calculator");
   if (lowFlux) return 1;
   
+  AliFMDCorrELossFit::ELossFit* fit = 0;
+  UShort_t                      n   = 0;
+  if (!FindNParticlesFit(d, r, eta, fit, n)) return 0;
+
+  return EvalNParticles(mult, fit, n, d, r, eta);
+}
+
+//_____________________________________________________________________
+Bool_t
+AliFMDDensityCalculator::FindNParticlesFit(UShort_t d, 
+					   Char_t   r, 
+					   Float_t  eta,
+					   AliFMDCorrELossFit::ELossFit*& fit, 
+					   UShort_t& n) const
+{
+  // 
+  // Find the energy loss fit and number of particles to use at eta
+  // 
   AliForwardCorrectionManager&  fcm = AliForwardCorrectionManager::Instance();
-  AliFMDCorrELossFit::ELossFit* fit = fcm.GetELossFit()->FindFit(d,r,eta, -1);
+  fit = fcm.GetELossFit()->FindFit(d,r,eta, -1);
+  n   = 0;
   if (!fit) { 
     AliWarning(Form("No energy loss fit for FMD%d%c at eta=%f qual=%d", 
 		    d, r, eta, fMinQuality));
-    return 0;
+    return false;
   }
   
   Int_t    m   = GetMaxWeight(d,r,eta); // fit->FindMaxWeight();
   if (m < 1) { 
     AliWarning(Form("No good fits for FMD%d%c at eta=%f", d, r, eta));
-    return 0;
+    fit = 0;
+    return false;
   }
   
-  UShort_t n   = TMath::Min(fMaxParticles, UShort_t(m));
+  n = TMath::Min(fMaxParticles, UShort_t(m));
+  return true;
+}
+
+//_____________________________________________________________________
+Float_t 
+AliFMDDensityCalculator::EvalNParticles(Float_t  mult, 
+					AliFMDCorrELossFit::ELossFit* fit, 
+					UShort_t n,
+					UShort_t d, 
+					Char_t   r, 
+					Float_t  eta) const
+{
+  // 
+  // Evaluate the number of particles from a fit 
+  // 
   Double_t ret = fit->EvaluateWeighted(mult, n);
   
   if (fDebug > 10) {
@@ -20,11 +20,11 @@
 #include "AliForwardUtil.h"
 #include "AliFMDMultCuts.h"
 #include "AliPoissonCalculator.h"
+#include "AliFMDCorrELossFit.h"
 class AliESDFMD;
 class TH2D;
 class TH1D;
 class TProfile;
-class AliFMDCorrELossFit;
 
 /** 
  * This class calculates the inclusive charged particle density
@@ -336,6 +336,44 @@ protected:
 			     Char_t   r, 
 			     Float_t  eta, 
 			     Bool_t   lowFlux) const;
+  /** 
+   * Look up the energy loss fit and the number of particles to
+   * include for a given @f$\eta@f$.  This is the part of NParticles
+   * that does not depend on the signal, and is cached per strip in
+   * Calculate.
+   * 
+   * @param d        Detector
+   * @param r        Ring 
+   * @param eta      Pseudo-rapidity 
+   * @param fit      On return, the fit or null
+   * @param n        On return, the number of particles to include
+   * 
+   * @return true if a usable fit was found 
+   */
+  Bool_t FindNParticlesFit(UShort_t d, 
+			   Char_t   r, 
+			   Float_t  eta, 
+			   AliFMDCorrELossFit::ELossFit*& fit, 
+			   UShort_t& n) const;
+  /** 
+   * Get the number of particles corresponding to the signal mult,
+   * using a fit found by FindNParticlesFit 
+   * 
+   * @param mult     Signal
+   * @param fit      Energy loss fit 
+   * @param n        Number of particles to include 
+   * @param d        Detector
+   * @param r        Ring 
+   * @param eta      Pseudo-rapidity 
+   * 
+   * @return The number of particles 
+   */
+  Float_t EvalNParticles(Float_t  mult, 
+			 AliFMDCorrELossFit::ELossFit* fit, 
+			 UShort_t n,
+			 UShort_t d, 
+			 Char_t   r, 
+			 Float_t  eta) const;
   /** 
    * Get the inverse correction factor.  This consist of
    * 
@@ -202,6 +202,8 @@ AliFMDEnergyFitter::CreateOutputObjects(TList* dir)
   d->Add(AliForwardUtil::MakeParameter("regCut",        fRegularizationCut));
   d->Add(AliForwardUtil::MakeParameter("deltaShift", 
 				       AliLandauGaus::EnableSigmaShift()));
+  d->Add(AliForwardUtil::MakeParameter("tabulated", 
+				       AliLandauGaus::EnableTabulated()));
 
   if (fRingHistos.GetEntries() <= 0) { 
     AliFatal("No ring histograms where defined - giving up!");
@@ -297,6 +299,12 @@ AliFMDEnergyFitter::SetEnableDeltaShift(Bool_t use)
 {
   AliLandauGaus::EnableSigmaShift(use ? 1 : 0);
 }
+//____________________________________________________________________
+void
+AliFMDEnergyFitter::SetEnableTabulated(Bool_t use) 
+{
+  AliLandauGaus::EnableTabulated(use ? 1 : 0);
+}
 
 //____________________________________________________________________
 Bool_t
@@ -405,6 +413,17 @@ AliFMDEnergyFitter::Fit(const TList* dir)
   // If we have no ring histograms, re-init. 
   if (fRingHistos.GetEntries() <= 0) Init();
 
+  // Validate the tabulated Landau-Gauss against the integration 
+  if (AliLandauGaus::EnableTabulated()) { 
+    Double_t dev = AliLandauGaus::CheckTable();
+    AliInfoF("Tabulated Landau-Gauss, max relative deviation %g", dev);
+    if (dev > 1e-4) {
+      AliWarningF("Deviation of tabulated Landau-Gauss too large (%g), "
+		  "using integration", dev);
+      AliLandauGaus::EnableTabulated(0);
+    }
+  }
+
   AliInfoF("Will do fits for %d rings", fRingHistos.GetEntries());
   TIter    next(&fRingHistos);
   RingHistos* o = 0;
@@ -582,6 +601,7 @@ AliFMDEnergyFitter::Print(Option_t*) const
   PFV("max(chi^2/nu)",	        fMaxChi2PerNDF);
   PFV("min(a_i)",	        fMinWeight);
   PFV("Regularization cut",     fRegularizationCut);
+  PFB("Tabulated L-G",          AliLandauGaus::EnableTabulated());
   TString r = "";
   switch (fResidualMethod) { 
   case kNoResiduals:              r = "None";       break;
@@ -299,6 +299,15 @@ public:
    * @param use If true, enable extra shift @f$\delta\Delta_p(\sigma/\xi)@f$  
    */
   void SetEnableDeltaShift(Bool_t use=true);
+  /**
+   * Whether to evaluate the Landau-Gauss convolution from a
+   * pre-computed table (see AliLandauGaus::FTab) rather than by
+   * numerical integration for each point.  The table is validated
+   * against the integration before the fits.
+   *
+   * @param use If true, use the tabulated evaluation
+   */
+  void SetEnableTabulated(Bool_t use=true);
 
   /* @} */
   // -----------------------------------------------------------------
@@ -54,6 +54,7 @@ AliFMDHistCollector::AliFMDHistCollector()
     fDoByCent(false)
 {
   DGUARD(fDebug, 3, "Default CTOR of AliFMDHistCollector");
+  for (Int_t i = 0; i < 5; i++) fScratch[i] = 0;
 }
 
 //____________________________________________________________________
@@ -75,6 +76,7 @@ AliFMDHistCollector::AliFMDHistCollector(const char* title)
     fDoByCent(false)
 {
   DGUARD(fDebug, 3, "Named CTOR of AliFMDHistCollector: %s", title);
+  for (Int_t i = 0; i < 5; i++) fScratch[i] = 0;
 }
 //____________________________________________________________________
 AliFMDHistCollector::AliFMDHistCollector(const AliFMDHistCollector& o)
@@ -95,6 +97,7 @@ AliFMDHistCollector::AliFMDHistCollector(const AliFMDHistCollector& o)
     fDoByCent(o.fDoByCent)
 {
   DGUARD(fDebug, 3, "Copy CTOR of AliFMDHistCollector");
+  for (Int_t i = 0; i < 5; i++) fScratch[i] = 0;
 }
 
 //____________________________________________________________________
@@ -102,6 +105,7 @@ AliFMDHistCollector::~AliFMDHistCollector()
 { 
   DGUARD(fDebug, 3, "DTOR of AliFMDHistCollector");
   // if (fList) delete fList;
+  for (Int_t i = 0; i < 5; i++) if (fScratch[i]) delete fScratch[i];
 }
 //____________________________________________________________________
 AliFMDHistCollector&
@@ -492,7 +496,7 @@ AliFMDHistCollector::Collect(const AliForwardUtil::Histos& hists,
   if (!bin) return false;
   Bool_t   ret     = bin->Collect(hists, sums, out, fSumRings, fSkipped, cent, 
 				  fMergeMethod, fSkipFMDRings,
-				  fByCent, eta2phi, add);
+				  fByCent, eta2phi, add, fScratch);
 
   return ret;
 }
@@ -584,7 +588,9 @@ AliFMDHistCollector::VtxBin::VtxBin(Int_t idx, Double_t minIpZ, Double_t maxIpZ,
     fHitMap(0), 
     fFirstBin(1), 
     fLastBin(1), 
-    fNCutBins(nCutBins)
+    fNCutBins(nCutBins),
+    fNEta(0),
+    fOverlap()
 {
 }
 //____________________________________________________________________
@@ -596,7 +602,9 @@ AliFMDHistCollector::VtxBin::VtxBin(const VtxBin& o)
     fHitMap(o.fHitMap), 
     fFirstBin(o.fFirstBin), 
     fLastBin(o.fLastBin),
-    fNCutBins(o.fNCutBins)
+    fNCutBins(o.fNCutBins),
+    fNEta(o.fNEta),
+    fOverlap(o.fOverlap)
 {
 }
 //____________________________________________________________________
@@ -611,6 +619,8 @@ AliFMDHistCollector::VtxBin::operator=(const VtxBin& o)
   fFirstBin = o.fFirstBin;
   fLastBin  = o.fLastBin;
   fNCutBins = o.fNCutBins;
+  fNEta     = o.fNEta;
+  fOverlap  = o.fOverlap;
   return *this;
 }
 //____________________________________________________________________
@@ -709,6 +719,18 @@ AliFMDHistCollector::VtxBin::SetupForData(TH2*           coverage,
       } // if (doSecHits)
     } // for (ie)
   } // for (iIdx)  
+
+  // Tabulate the overlapping ring per ring and eta bin, now that
+  // the first and last bins of all rings are known
+  fNEta = etaAxis.GetNbins();
+  fOverlap.Set(5 * (fNEta+2));
+  for (Int_t iIdx = 0; iIdx < 5; iIdx++) {
+    UShort_t d = 0;
+    Char_t   r = 0;
+    GetDetRing(iIdx, d, r);
+    for (Int_t ie = 0; ie <= fNEta+1; ie++) 
+      fOverlap[iIdx * (fNEta+2) + ie] = GetOverlap(d, r, ie);
+  }
 }
   
 //____________________________________________________________________
@@ -774,7 +796,8 @@ AliFMDHistCollector::VtxBin::Collect(const AliForwardUtil::Histos& hists,
 				     UShort_t                      skips,
 				     TList*                        byCent,
 				     Bool_t                        eta2phi,
-				     Bool_t                        add)
+				     Bool_t                        add,
+				     TH2D**                        scratch)
 {
   for (UShort_t d=1; d<=3; d++) { 
     UShort_t nr = (d == 1 ? 1 : 2);
@@ -790,7 +813,25 @@ AliFMDHistCollector::VtxBin::Collect(const AliForwardUtil::Histos& hists,
 	continue;
       }
       TH2D*       o = sums.Get(d, r);
-      TH2D*       t = static_cast<TH2D*>(h->Clone(Form("FMD%d%c_tmp",d,r)));
+      Int_t       iIdx = GetIdx(d, r);
+
+      // Copy the input into a scratch histogram.  The scratch copy
+      // is kept between events (as long as the binning does not
+      // change) rather than cloning the input for every ring and event
+      TH2D*       t = (scratch ? scratch[iIdx] : 0);
+      if (t && 
+	  t->GetNbinsX() == h->GetNbinsX() && 
+	  t->GetNbinsY() == h->GetNbinsY() && 
+	  t->GetSumw2N() == h->GetSumw2N()) { 
+	t->Reset();
+	t->Add(h);
+      }
+      else {
+	if (t) delete t;
+	t = static_cast<TH2D*>(h->Clone(Form("FMD%d%c_tmp",d,r)));
+	t->SetDirectory(0);
+	if (scratch) scratch[iIdx] = t;
+      }
       
       // Get valid range 
       Int_t first = 0;
@@ -864,20 +905,33 @@ AliFMDHistCollector::VtxBin::Collect(const AliForwardUtil::Histos& hists,
 	} // if (byCent)
       } // if (add)
 
-      // Outer rings have better phi segmentation - rebin to same as inner. 
-      if (q == 1) {
+      // Outer rings have better phi segmentation - rebin to same as
+      // inner.  Rather than rebinning the histogram (which changes
+      // the binning of the scratch copy), the phi bins are merged
+      // when reading the flat content and error arrays below.  This
+      // is the same as TH2::RebinY(2) for an even number of bins.
+      Int_t rebin = (q == 1 ? 2 : 1);
+      TH2D* rt    = 0;
+      if (rebin > 1 && (nY % rebin) != 0) { 
 	// PRINT_OVERFLOW(d, r, "before", t);
-	t->RebinY(2);	
-	// PRINT_OVERFLOW(d, r, "after", t);
+	rt    = static_cast<TH2D*>(t->RebinY(rebin, Form("FMD%d%c_rebin",d,r)));
+	rt->SetDirectory(0);
+	rebin = 1;
+	// PRINT_OVERFLOW(d, r, "after", rt);
       }
-
-      nY = t->GetNbinsY();
+      const TH2D*     src   = (rt ? rt : t);
+      const Int_t     srcNX = src->GetNbinsX() + 2;
+      const Int_t     srcNY = src->GetNbinsY();
+      const Double_t* cont  = src->GetArray();
+      const Double_t* sumw2 = (src->GetSumw2N() > 0 ? 
+			       src->GetSumw2()->GetArray() : 0);
+      nY = srcNY / rebin;
 
       // Now update profile output 
       for (Int_t iEta = first; iEta <= last; iEta++) { 
 
 	// Get the possibly overlapping histogram 
-	Int_t overlap = GetOverlap(d,r,iEta);
+	Int_t overlap = GetCachedOverlap(iIdx,d,r,iEta);
 
 	// Get factor 
 	MergeMethod mm  = m; // Possibly override method locally
@@ -919,7 +973,7 @@ AliFMDHistCollector::VtxBin::Collect(const AliForwardUtil::Histos& hists,
 
 	// Fill phi acceptance for this event into the phi overflow bin
 	Float_t oop      = out.GetBinContent(iEta,nY+1);
-	Float_t nop      = t->GetBinContent(iEta,nY+1);
+	Float_t nop      = cont[iEta + srcNX * (srcNY+1)];
 #if 0
 	Info("", "etaBin=%3d Setting phi acceptance to %f(%f+%f)=%f", 
 	     iEta, fac, oop, nop, fac*(oop+nop));
@@ -927,10 +981,16 @@ AliFMDHistCollector::VtxBin::Collect(const AliForwardUtil::Histos& hists,
 	out.SetBinContent(iEta, nY+1, fac * nop + oop);
 
 	// Should we loop over h or t Y bins - I think it's t
+	Double_t ee = src->GetXaxis()->GetBinCenter(iEta);
 	for (Int_t iPhi = 1; iPhi <= nY; iPhi++) { 
-	  Double_t c  = t->GetBinContent(iEta,iPhi);
-	  Double_t e  = t->GetBinError(iEta,iPhi);
-	  Double_t ee = t->GetXaxis()->GetBinCenter(iEta);
+	  Double_t c  = 0;
+	  Double_t e2 = 0;
+	  for (Int_t k = 0; k < rebin; k++) { 
+	    Int_t bin = iEta + srcNX * ((iPhi-1) * rebin + k + 1);
+	    c        += cont[bin];
+	    if (sumw2) e2 += sumw2[bin];
+	  }
+	  Double_t e  = (sumw2 ? TMath::Sqrt(e2) : TMath::Sqrt(TMath::Abs(c)));
 	  sumRings->Fill(ee, i, c);
 
 	  // If there's no signal or the signal was ignored because we
@@ -956,14 +1016,25 @@ AliFMDHistCollector::VtxBin::Collect(const AliForwardUtil::Histos& hists,
 	  out.SetBinError(iEta,iPhi, re);
 	}
       }
-      // Remove temporary histogram 
-      delete t;
+      // Remove temporary histograms 
+      if (rt) delete rt;
+      if (!scratch) delete t;
     } // for r
   } // for d 
   return true;
 }
 //____________________________________________________________________
 Int_t 
+AliFMDHistCollector::VtxBin::GetCachedOverlap(Int_t idx, UShort_t d, 
+					      Char_t r, Int_t bin) const
+{
+  if (idx < 0 || idx >= 5 || bin < 0 || bin > fNEta+1 || 
+      fOverlap.GetSize() != 5 * (fNEta+2)) 
+    return GetOverlap(d, r, bin);
+  return fOverlap[idx * (fNEta+2) + bin];
+}
+//____________________________________________________________________
+Int_t 
 AliFMDHistCollector::VtxBin::GetOverlap(UShort_t d, Char_t r, 
 					Int_t bin) const
 {
@@ -386,7 +386,9 @@ protected:
      * @param skips      Which rings to skip
      * @param byCent     List (or null) of per centrality sums
      * @param eta2phi    Copy eta coverage to phi acceptance 
-     * @param add      If true, add to internal caches
+     * @param add        If true, add to internal caches
+     * @param scratch    Per-ring (0-4) scratch histograms, re-used 
+     *                   between events 
      *
      * @return true on success
      */
@@ -400,7 +402,8 @@ protected:
 		   UShort_t                      skips,
 		   TList*                        byCent,
 		   Bool_t                        eta2phi,
-		   Bool_t                        add);
+		   Bool_t                        add,
+		   TH2D**                        scratch);
     /** 
      * Check if there's an overlap between detector @a d, ring @a r
      * and some other ring for the given @f$\eta@f$ @a bin.  If so,
@@ -413,6 +416,17 @@ protected:
      * @return Index of overlapping ring, or -1
      */    
     Int_t GetOverlap(UShort_t d, Char_t r, Int_t bin) const;
+    /** 
+     * Same as GetOverlap, but using the table filled in SetupForData 
+     * 
+     * @param idx  Current ring index (0-4)
+     * @param d    Current detector
+     * @param r    Current ring
+     * @param bin  Current @f$\eta@f$ bin
+     * 
+     * @return Index of overlapping ring, or -1
+     */    
+    Int_t GetCachedOverlap(Int_t idx, UShort_t d, Char_t r, Int_t bin) const;
     /** 
      * Get the first and last @f$\eta@f$ bin for a detector 
      * 
@@ -475,6 +489,8 @@ protected:
     TArrayI                 fFirstBin;  // Per-ring first bin
     TArrayI                 fLastBin;   // Per-ring last bin
     Int_t                   fNCutBins;  // Number of bins to cut 
+    Int_t                   fNEta;      // Number of eta bins in fOverlap
+    TArrayI                 fOverlap;   // Per-ring and eta bin overlap
 
     // ClassDef(VtxBin,1); // Vertex bin in histogram collector
   };
@@ -509,7 +525,8 @@ protected:
   TObjArray*  fVtxList;         //! Per-vertex list
   TList*      fByCent;          // By centrality sums
   Bool_t      fDoByCent;        // Whether to do by centrality sum
-  ClassDef(AliFMDHistCollector,6); // Calculate Nch density 
+  TH2D*       fScratch[5];      //! Per-ring scratch histograms
+  ClassDef(AliFMDHistCollector,7); // Calculate Nch density 
 };
 
 
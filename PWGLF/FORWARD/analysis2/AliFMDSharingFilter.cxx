@@ -215,6 +215,25 @@ AliFMDSharingFilter::Filter(const AliESDFMD& input,
   Int_t nDouble    = 0;
   Int_t nTriple    = 0;
 
+  // Whether the read signals are used as is (see SignalInStrip) 
+  const Bool_t asIs = 
+    (fCorrectAngles && (fIgnoreESDForAngleCorrection || 
+			input.IsAngleCorrected())) || 
+    (!fCorrectAngles && !fIgnoreESDForAngleCorrection && 
+     !input.IsAngleCorrected());
+
+  // Flat buffers of one sector, and per-strip cache of the eta
+  // dependent cuts and angle correction.  The pseudo-rapidity of a
+  // strip in the ESD does not depend on the sector, so the cuts and
+  // correction are evaluated once per strip in the ring (and again
+  // only if eta changes).
+  Float_t  signal[512];
+  Double_t stripEta[512];
+  Double_t stripLow[512];
+  Double_t stripHigh[512];
+  Double_t stripCos[512];
+  Bool_t   stripSet[512];
+
   for(UShort_t d = 1; d <= 3; d++) {
     Int_t nRings = (d == 1 ? 1 : 2);
     for (UShort_t q = 0; q < nRings; q++) {
@@ -222,8 +241,26 @@ AliFMDSharingFilter::Filter(const AliESDFMD& input,
       UShort_t    nsec   = (q == 0 ?  20 :  40);
       UShort_t    nstr   = (q == 0 ? 512 : 256);
       RingHistos* histos = GetRingHistos(d, r);
+
+      for (UShort_t t = 0; t < nstr; t++) stripSet[t] = false;
       
       for(UShort_t s = 0; s < nsec;  s++) {	
+	// Copy the sector into the flat buffer, updating the cache 
+	for (UShort_t t = 0; t < nstr; t++) { 
+	  Double_t eta = input.Eta(d,r,s,t);
+	  if (!stripSet[t] || stripEta[t] != eta) { 
+	    stripSet[t]  = true;
+	    stripEta[t]  = eta;
+	    stripLow[t]  = GetLowCut(d, r, eta);
+	    stripHigh[t] = GetHighCut(d, r, eta, false);
+	    stripCos[t]  = AngleCorrect(1, eta);
+	  }
+	  Double_t mult = input.Multiplicity(d,r,s,t);
+	  if (!(mult == AliESDFMD::kInvalidMult || mult == 0 || asIs)) 
+	    mult = (fCorrectAngles ? mult * stripCos[t] : mult / stripCos[t]);
+	  signal[t] = mult;
+	}
+
 	// `used' flags if the _current_ strip was used by _previous_ 
 	// iteration. 
 	Bool_t   used            = kFALSE;
@@ -241,15 +278,15 @@ AliFMDSharingFilter::Filter(const AliESDFMD& input,
 	  // nDistanceAfter++;
 
 	  output.SetMultiplicity(d,r,s,t,0.);
-	  Float_t mult         = SignalInStrip(input,d,r,s,t);
-	  Float_t multNext     = (t<nstr-1) ? SignalInStrip(input,d,r,s,t+1) :0;
-	  Float_t multNextNext = (t<nstr-2) ? SignalInStrip(input,d,r,s,t+2) :0;
+	  Float_t mult         = signal[t];
+	  Float_t multNext     = (t<nstr-1) ? signal[t+1] :0;
+	  Float_t multNextNext = (t<nstr-2) ? signal[t+2] :0;
 	  if (multNext     ==  AliESDFMD::kInvalidMult) multNext     = 0;
 	  if (multNextNext ==  AliESDFMD::kInvalidMult) multNextNext = 0;
 	  if(!fThreeStripSharing) multNextNext = 0;
 
 	  // Get the pseudo-rapidity 
-	  Double_t eta = input.Eta(d,r,s,t);
+	  Double_t eta = stripEta[t];
 	  Double_t phi = input.Phi(d,r,s,t) * TMath::Pi() / 180.;
 	  if (s == 0) output.SetEta(d,r,s,t,eta);
 	  
@@ -262,8 +299,8 @@ AliFMDSharingFilter::Filter(const AliESDFMD& input,
 	    mult = AliESDFMD::kInvalidMult;
 	  }
 	  
-	  Double_t lowCut  = GetLowCut(d, r, eta);
-	  Double_t highCut = GetHighCut(d, r, eta, false);
+	  Double_t lowCut  = stripLow[t];
+	  Double_t highCut = stripHigh[t];
 	  if (mult != AliESDFMD::kInvalidMult && mult > lowCut) {
 	    // Always fill the ESD sum histogram 
 	    histos->fSumESD->Fill(eta, phi, mult);
@@ -405,7 +442,7 @@ AliFMDSharingFilter::Filter(const AliESDFMD& input,
 	  } // if (!fMergingDisabled)
 
 	  if (!fCorrectAngles)
-	    mergedEnergy = AngleCorrect(mergedEnergy, eta);
+	    mergedEnergy = mergedEnergy * stripCos[t];
 	  // if (mergedEnergy > 0) histos->Incr();
 	  
 	  if (t != 0) 
@@ -164,6 +164,102 @@ public:
   static Int_t NSteps() { return 100; }
   /* @} */
 
+  //__________________________________________________________________
+  /** 
+   * @{ 
+   * @name Tabulated evaluation 
+   *
+   * The numerical convolution in F only depends on the scaled
+   * variables @f$ t=(x-\Delta_p)/\xi@f$ and @f$ u=\sigma'/\xi@f$,
+   * since
+   *
+   * @f[ 
+   *   f(x;\Delta_p,\xi,\sigma') = \frac{1}{\xi} f(t;0,1,u)
+   * @f]
+   *
+   * holds also for the discrete sum over NSteps() points.  The
+   * function @f$ f(t;0,1,u)@f$ is therefore computed once on a grid
+   * in @f$(t,u)@f$ and evaluated by bi-cubic Lagrange interpolation.
+   * Points outside of the grid are calculated with the full
+   * integration.  The tabulated evaluation is off by default and
+   * is enabled with EnableTabulated.
+   */
+  //------------------------------------------------------------------
+  /** 
+   * Lower edge of the table in @f$ t=(x-\Delta_p)/\xi@f$ 
+   */
+  static Double_t TableTMin() { return -10; }
+  /** 
+   * Upper edge of the table in @f$ t=(x-\Delta_p)/\xi@f$ 
+   */
+  static Double_t TableTMax() { return 150; }
+  /** 
+   * Step size of the table in @f$ t@f$ 
+   */
+  static Double_t TableDT() { return 0.05; }
+  /** 
+   * Lower edge of the table in @f$ u=\sigma'/\xi@f$ 
+   */
+  static Double_t TableUMin() { return 0.05; }
+  /** 
+   * Upper edge of the table in @f$ u=\sigma'/\xi@f$ 
+   */
+  static Double_t TableUMax() { return 4.05; }
+  /** 
+   * Step size of the table in @f$ u@f$ 
+   */
+  static Double_t TableDU() { return 0.05; }
+  /** 
+   * Whether to use the tabulated evaluation of the convolution 
+   * 
+   * @param val If 0 or 1, set the state, otherwise only query 
+   * 
+   * @return true if the tabulated evaluation is enabled 
+   */
+  static Bool_t EnableTabulated(Short_t val=-1);
+  /** 
+   * Get the table of @f$ f(t;0,1,u)@f$, building it on first use.
+   * The table is stored with @f$ t@f$ running fastest.
+   * 
+   * @param nT On return, number of points in @f$ t@f$ 
+   * @param nU On return, number of points in @f$ u@f$ 
+   * 
+   * @return Pointer to the table 
+   */
+  static const Double_t* Table(Int_t& nT, Int_t& nU);
+  /** 
+   * Evaluate the Landau-Gauss convolution from the table.  If the
+   * point is outside of the table, the integration (F) is used.
+   * 
+   * @param x       Where to evaluate @f$ f@f$ 
+   * @param delta   @f$\Delta_p@f$ of @f$ f(x;\Delta_p,\xi,\sigma')@f$ 
+   * @param xi      @f$ \xi@f$ of @f$ f(x;\Delta_p,\xi,\sigma')@f$ 
+   * @param sigma   @f$\sigma@f$ of the Gaussian 
+   * @param sigma_n @f$\sigma_n@f$ of the Gaussian 
+   * 
+   * @return @f$ f(x;\Delta_p,\xi,\sigma')@f$ 
+   */
+  static Double_t FTab(Double_t x, Double_t delta, Double_t xi, 
+		       Double_t sigma, Double_t sigma_n);
+  /** 
+   * Largest deviation of the tabulated from the integrated
+   * evaluation for a given @f$ u=\sigma'/\xi@f$, relative to the
+   * maximum of the distribution.  Used to validate the table.
+   * 
+   * @param u  @f$ u=\sigma'/\xi@f$ 
+   * 
+   * @return Largest relative deviation 
+   */
+  static Double_t TableDeviation(Double_t u);
+  /** 
+   * Largest relative deviation (see TableDeviation) over a set of
+   * @f$ u@f$ values covering the table.
+   * 
+   * @return Largest relative deviation 
+   */
+  static Double_t CheckTable();
+  /* @} */
+
   //__________________________________________________________________
   /** 
    * @{ 
@@ -283,6 +379,27 @@ public:
   static Double_t Fn(Double_t x, Double_t delta, Double_t xi, 
 		     Double_t sigma, Double_t sigma_n, Int_t n, 
 		     const Double_t* a);
+  //------------------------------------------------------------------
+  /** 
+   * Evaluate @f$ f_N@f$ (see Fn) for an array of points, e.g., all
+   * bin centres of a histogram.  The parameters of each
+   * @f$ f_i@f$ are computed once, and the points are processed in
+   * a flat loop per @f$ i@f$.
+   * 
+   * @param nx       Number of points 
+   * @param x        Where to evaluate @f$ f_N@f$ 
+   * @param out      On return, @f$ f_N(x)@f$ for each point 
+   * @param delta    @f$ \Delta_{p}@f$ 
+   * @param xi       @f$ \xi@f$ 
+   * @param sigma    @f$ \sigma@f$ 
+   * @param sigma_n  @f$ \sigma_n@f$ 
+   * @param n        Number of particles, @f$ N@f$ 
+   * @param a        Weights @f$ a_2,\ldots,a_N@f$ 
+   */
+  static void FnN(Int_t nx, const Double_t* x, Double_t* out, 
+		  Double_t delta, Double_t xi, 
+		  Double_t sigma, Double_t sigma_n, Int_t n, 
+		  const Double_t* a);
   /** 
    * Get parameters for the @f$ i@f$ particle response.
    *
@@ -484,6 +601,101 @@ AliLandauGaus::EnableSigmaShift(Short_t val)
   return enabled;
 }
 //____________________________________________________________________
+inline Bool_t
+AliLandauGaus::EnableTabulated(Short_t val)
+{
+  static Bool_t enabled = false;
+  if (val >= 0) enabled = val == 1;
+  return enabled;
+}
+//____________________________________________________________________
+inline const Double_t*
+AliLandauGaus::Table(Int_t& nT, Int_t& nU)
+{
+  static Double_t* table = 0;
+  nT = Int_t((TableTMax() - TableTMin()) / TableDT() + .5) + 1;
+  nU = Int_t((TableUMax() - TableUMin()) / TableDU() + .5) + 1;
+  if (table) return table;
+
+  Double_t* tab = new Double_t[nT * nU];
+  for (Int_t iu = 0; iu < nU; iu++) { 
+    Double_t u = TableUMin() + iu * TableDU();
+    for (Int_t it = 0; it < nT; it++) 
+      tab[iu * nT + it] = F(TableTMin() + it * TableDT(), 0, 1, u, 0);
+  }
+  table = tab;
+  return table;
+}
+//____________________________________________________________________
+inline Double_t 
+AliLandauGaus::FTab(Double_t x, Double_t delta, Double_t xi,
+		    Double_t sigma, Double_t sigmaN)
+{
+  if (xi <= 0) return 0;
+  const Double_t sigma1 = sigmaN == 0 ? sigma : 
+    TMath::Sqrt(sigmaN*sigmaN + sigma*sigma);
+  const Double_t t      = (x - delta) / xi;
+  const Double_t u      = sigma1 / xi;
+  if (t < TableTMin() || t > TableTMax() || 
+      u < TableUMin() || u > TableUMax()) 
+    return F(x, delta, xi, sigma, sigmaN);
+
+  Int_t nT, nU;
+  const Double_t* tab = Table(nT, nU);
+  // Four point stencil, moved inside the table at the edges 
+  const Double_t ft = (t - TableTMin()) / TableDT();
+  const Double_t fu = (u - TableUMin()) / TableDU();
+  const Int_t    it = TMath::Max(0, TMath::Min(nT - 4, Int_t(ft) - 1));
+  const Int_t    iu = TMath::Max(0, TMath::Min(nU - 4, Int_t(fu) - 1));
+  const Double_t pt = ft - it;
+  const Double_t pu = fu - iu;
+  // Cubic Lagrange weights for nodes at 0,1,2,3 
+  Double_t wt[4], wu[4];
+  wt[0] = -(pt-1)*(pt-2)*(pt-3)/6;
+  wt[1] =  pt    *(pt-2)*(pt-3)/2;
+  wt[2] = -pt    *(pt-1)*(pt-3)/2;
+  wt[3] =  pt    *(pt-1)*(pt-2)/6;
+  wu[0] = -(pu-1)*(pu-2)*(pu-3)/6;
+  wu[1] =  pu    *(pu-2)*(pu-3)/2;
+  wu[2] = -pu    *(pu-1)*(pu-3)/2;
+  wu[3] =  pu    *(pu-1)*(pu-2)/6;
+
+  Double_t sum = 0;
+  for (Int_t j = 0; j < 4; j++) { 
+    const Double_t* row = tab + (iu + j) * nT + it;
+    sum += wu[j] * (wt[0]*row[0] + wt[1]*row[1] + wt[2]*row[2] + wt[3]*row[3]);
+  }
+  return sum / xi;
+}
+//____________________________________________________________________
+inline Double_t 
+AliLandauGaus::TableDeviation(Double_t u)
+{
+  // Off-grid points in t, scanning the peak and the tail 
+  const Int_t    nTest = 2000;
+  const Double_t tMin  = -5;
+  const Double_t tMax  = 60;
+  Double_t maxF   = 0;
+  Double_t maxDev = 0;
+  for (Int_t i = 0; i < nTest; i++) { 
+    Double_t t  = tMin + (i + .37) * (tMax - tMin) / nTest;
+    Double_t f  = F(t, 0, 1, u, 0);
+    Double_t ft = FTab(t, 0, 1, u, 0);
+    maxF        = TMath::Max(maxF, f);
+    maxDev      = TMath::Max(maxDev, TMath::Abs(ft - f));
+  }
+  return maxF > 0 ? maxDev / maxF : 0;
+}
+//____________________________________________________________________
+inline Double_t 
+AliLandauGaus::CheckTable()
+{
+  Double_t maxDev = 0;
+  for (Double_t u = TableUMin() + .013; u < TableUMax(); u += .29) 
+    maxDev = TMath::Max(maxDev, TableDeviation(u));
+  return maxDev;
+}
+//____________________________________________________________________
 inline void
 AliLandauGaus::IPars(Int_t i, Double_t& delta, Double_t& xi, Double_t& sigma)
 {
@@ -561,6 +773,7 @@ AliLandauGaus::Fi(Double_t x, Double_t delta, Double_t xi,
     // Fall back to landau 
     return Fl(x, deltaI, xiI);
   
+  if (EnableTabulated()) return FTab(x, deltaI, xiI, sigmaI, sigmaN);
   return F(x, deltaI, xiI, sigmaI, sigmaN);
 }
 //____________________________________________________________________
@@ -575,6 +788,34 @@ AliLandauGaus::Fn(Double_t x, Double_t delta, Double_t xi,
   return result;
 }
 
+//____________________________________________________________________
+inline void
+AliLandauGaus::FnN(Int_t nx, const Double_t* x, Double_t* out, 
+		   Double_t delta, Double_t xi, 
+		   Double_t sigma, Double_t sigmaN, Int_t n, 
+		   const Double_t* a)
+{
+  const Bool_t tab = EnableTabulated();
+  for (Int_t j = 0; j < nx; j++) out[j] = 0;
+  for (Int_t i = 1; i <= n; i++) { 
+    const Double_t ai     = (i == 1 ? 1 : a[i-2]);
+    Double_t       deltaI = delta;
+    Double_t       xiI    = xi;
+    Double_t       sigmaI = sigma;
+    IPars(i, deltaI, xiI, sigmaI);
+    if (sigmaI < 1e-10) { 
+      for (Int_t j = 0; j < nx; j++) out[j] += ai * Fl(x[j], deltaI, xiI);
+    }
+    else if (tab) { 
+      for (Int_t j = 0; j < nx; j++) 
+	out[j] += ai * FTab(x[j], deltaI, xiI, sigmaI, sigmaN);
+    }
+    else { 
+      for (Int_t j = 0; j < nx; j++) 
+	out[j] += ai * F(x[j], deltaI, xiI, sigmaI, sigmaN);
+    }
+  }
+}
 //____________________________________________________________________
 inline Double_t 
 AliLandauGaus::DFidPar(Double_t x, 
@@ -661,6 +902,7 @@ AliLandauGaus::F1Func(Double_t* xp, Double_t* pp)
   Double_t sigma    = pp[kSigma];
   Double_t sigmaN   = pp[kSigmaN];
   
+  if (EnableTabulated()) return constant * FTab(x, delta, xi, sigma, sigmaN);
   return constant * F(x, delta, xi, sigma, sigmaN);
 }
 //____________________________________________________________________
@@ -706,6 +948,9 @@ AliLandauGaus::CompFunc(Double_t* xp, Double_t* pp)
   Double_t xiS         = pp[kSigma+2/*3*/];
   Double_t sigmaS      = sigmaP; // pp[kSigma+4];
   
+  if (EnableTabulated()) 
+    return (cP * FTab(x,deltaP,xiP,sigmaP,0) + 
+	    cS * FTab(x,deltaS,xiS,sigmaS,0));
   return (cP * F(x,deltaP,xiP,sigmaP,0) + 
 	  cS * F(x,deltaS,xiS,sigmaS,0));
 
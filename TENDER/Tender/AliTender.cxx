@@ -15,8 +15,13 @@
 
 /* $Id$ */
 
+#include <thread>
+#include <vector>
+
 #include <TChain.h>
 #include <TFile.h>
+#include <TROOT.h>
+#include <RVersion.h>
  
 #include "AliTender.h"
 #include "AliTenderSupply.h"
@@ -41,7 +46,10 @@ AliTender::AliTender():
            fESDhandler(NULL),
            fESD(NULL),
            fSupplies(NULL),
-           fCDBSettings(NULL)
+           fCDBSettings(NULL),
+           fConcurrentSupplies(kFALSE),
+           fNStages(0),
+           fStage()
 {
 // Dummy constructor
 }
@@ -58,7 +66,10 @@ AliTender::AliTender(const char* name):
            fESDhandler(NULL),
            fESD(NULL),
            fSupplies(NULL),
-           fCDBSettings(NULL)
+           fCDBSettings(NULL),
+           fConcurrentSupplies(kFALSE),
+           fNStages(0),
+           fStage()
 {
 // Default constructor
   DefineOutput(1,  AliESDEvent::Class());
@@ -130,6 +141,58 @@ void AliTender::ConnectInputData(Option_t* option)
   TIter next(fSupplies);
   AliTenderSupply *supply;
   while ((supply=(AliTenderSupply*)next())) supply->Init();
+  // Supplies may declare their data sets in Init()
+  BuildSchedule();
+}
+
+//______________________________________________________________________________
+void AliTender::BuildSchedule()
+{
+// Assign each supply to a stage: a supply runs after all the supplies added
+// before it which write data it uses or use data it writes. Supplies in the
+// same stage are independent. With the default data sets (everything) the
+// schedule is the order in which the supplies were added.
+  Int_t nsupplies = fSupplies ? fSupplies->GetEntriesFast() : 0;
+  fStage.Set(nsupplies);
+  fNStages = 0;
+  for (Int_t i=0; i<nsupplies; i++) {
+    AliTenderSupply *supply = (AliTenderSupply*)fSupplies->At(i);
+    Int_t stage = 0;
+    for (Int_t j=0; j<i; j++) {
+      if (fStage[j] >= stage && supply->DependsOn((AliTenderSupply*)fSupplies->At(j))) stage = fStage[j]+1;
+    }
+    fStage[i] = stage;
+    if (stage >= fNStages) fNStages = stage+1;
+  }
+  if (fDebug > 0) {
+    for (Int_t i=0; i<nsupplies; i++) 
+      Printf("AliTender: supply %s in stage %d", fSupplies->At(i)->GetName(), fStage[i]);
+  }
+}
+
+//______________________________________________________________________________
+void AliTender::ProcessStage(Int_t stage)
+{
+// Process the event with the supplies of one stage, concurrently if requested
+// and possible.
+  Int_t nsupplies = fSupplies->GetEntriesFast();
+  std::vector<AliTenderSupply*> supplies;
+  Bool_t threadSafe = kTRUE;
+  for (Int_t i=0; i<nsupplies; i++) {
+    if (fStage[i] != stage) continue;
+    AliTenderSupply *supply = (AliTenderSupply*)fSupplies->At(i);
+    supplies.push_back(supply);
+    threadSafe &= supply->IsThreadSafe();
+  }
+  if (!fConcurrentSupplies || fRunChanged || !threadSafe || supplies.size() < 2) {
+    for (UInt_t i=0; i<supplies.size(); i++) supplies[i]->ProcessEvent();
+    return;
+  }
+  // The first supply runs in this thread
+  std::vector<std::thread> threads;
+  for (UInt_t i=1; i<supplies.size(); i++) threads.push_back(std::thread(&AliTenderSupply::ProcessEvent, supplies[i]));
+  supplies[0]->ProcessEvent();
+  for (UInt_t i=0; i<threads.size(); i++) threads[i].join();
 }
 
 //______________________________________________________________________________
@@ -142,6 +205,9 @@ void AliTender::UserCreateOutputObjects()
      fESDhandler->SetUserCallSelectionMask(kTRUE);
      Info("UserCreateOutputObjects","The TENDER will check the event selection. Make sure you add the tender as FIRST wagon!");
   }   
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,6,0)
+  if (fConcurrentSupplies) ROOT::EnableThreadSafety();
+#endif
 }
 
 //______________________________________________________________________________
@@ -170,9 +236,8 @@ void AliTender::UserExec(Option_t* option)
       fCDBkey = fCDB->SetLock(kTRUE, fCDBkey);
     } 
   }
-  TIter next(fSupplies);
-  AliTenderSupply *supply;
-  while ((supply=(AliTenderSupply*)next())) supply->ProcessEvent();
+  if (fSupplies && fStage.GetSize() != fSupplies->GetEntriesFast()) BuildSchedule();
+  for (Int_t stage=0; stage<fNStages; stage++) ProcessStage(stage);
   fRunChanged = kFALSE;
 
   if (TObject::TestBit(kCheckEventSelection)) fESDhandler->CheckSelectionMask();
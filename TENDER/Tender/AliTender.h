@@ -16,6 +16,9 @@
 #ifndef ALIANALYSISTASKSE_H
 #include "AliAnalysisTaskSE.h"
 #endif
+#ifndef ROOT_TArrayI
+#include "TArrayI.h"
+#endif
 
 // #ifndef ALIESDINPUTHANDLER_H
 // #include "AliESDInputHandler.h"
@@ -43,9 +46,15 @@ private:
   AliESDEvent              *fESD;            //! Pointer to current ESD event
   TObjArray                *fSupplies;       // Array of tender supplies
   TObjArray                *fCDBSettings;    // Array with CDB configuration
+  Bool_t                    fConcurrentSupplies; // Run independent thread-safe supplies concurrently
+  Int_t                     fNStages;        //! Number of stages of the supply schedule
+  TArrayI                   fStage;          //! Stage of each supply in the schedule
   
   AliTender(const AliTender &other);
   AliTender& operator=(const AliTender &other);
+  
+  void                      BuildSchedule();
+  void                      ProcessStage(Int_t stage);
 
 public:  
   AliTender();
@@ -68,6 +77,14 @@ public:
    */
   void 			    SetHandleOCDB(Bool_t doHandle) { fHandleCDB = doHandle; }
   void SetESDhandler(AliESDInputHandler*esdH) {fESDhandler = esdH;}
+  /**
+   * Run the supplies of a schedule stage concurrently when all of them are thread safe.
+   * Events with a run change are always processed serially since OCDB access is not thread safe.
+   * @param[in] flag If true, independent supplies may process the event in parallel
+   */
+  void                      SetConcurrentSupplies(Bool_t flag=kTRUE) {fConcurrentSupplies = flag;}
+  Int_t                     GetNStages() const {return fNStages;}
+  Int_t                     GetSupplyStage(Int_t i) const {return (i>=0 && i<fStage.GetSize()) ? fStage[i] : -1;}
 
   // Run control
   virtual void              ConnectInputData(Option_t *option = "");
@@ -75,6 +92,6 @@ public:
 //  virtual Bool_t            Notify() {return kTRUE;}
   virtual void              UserExec(Option_t *option);
     
-  ClassDef(AliTender,4)  // Class describing the tender car for ESD analysis
+  ClassDef(AliTender,5)  // Class describing the tender car for ESD analysis
 };
 #endif
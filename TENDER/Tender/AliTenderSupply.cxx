@@ -23,7 +23,9 @@ ClassImp(AliTenderSupply)
 //______________________________________________________________________________
 AliTenderSupply::AliTenderSupply()
                 :TNamed(),
-                 fTender(NULL)
+                 fTender(NULL),
+                 fReadSet(kDataAll),
+                 fWriteSet(kDataAll)
 {
 // Dummy constructor
 }
@@ -31,7 +33,9 @@ AliTenderSupply::AliTenderSupply()
 //______________________________________________________________________________
 AliTenderSupply::AliTenderSupply(const char* name, const AliTender *tender)
                 :TNamed(name, "ESD analysis tender car"),
-                 fTender(tender)
+                 fTender(tender),
+                 fReadSet(kDataAll),
+                 fWriteSet(kDataAll)
 {
 // Default constructor
 }
@@ -39,7 +43,9 @@ AliTenderSupply::AliTenderSupply(const char* name, const AliTender *tender)
 //______________________________________________________________________________
 AliTenderSupply::AliTenderSupply(const AliTenderSupply &other)
                 :TNamed(other),
-                 fTender(other.fTender)
+                 fTender(other.fTender),
+                 fReadSet(other.fReadSet),
+                 fWriteSet(other.fWriteSet)
                  
 {
 // Copy constructor
@@ -58,5 +64,7 @@ AliTenderSupply& AliTenderSupply::operator=(const AliTenderSupply &other)
    if (&other == this) return *this;
    TNamed::operator=(other);
    fTender = other.fTender;
+   fReadSet = other.fReadSet;
+   fWriteSet = other.fWriteSet;
    return *this;
 }
@@ -18,8 +18,27 @@ class AliTender;
 
 class AliTenderSupply : public TNamed {
 
+public:
+enum ETenderData {
+   kDataNone         = 0,
+   kDataHeader       = BIT(0),  // event header, run and trigger information
+   kDataVertex       = BIT(1),  // primary vertices
+   kDataTracks       = BIT(2),  // ESD tracks
+   kDataV0s          = BIT(3),  // V0s and cascades
+   kDataCaloClusters = BIT(4),  // EMCAL and PHOS clusters
+   kDataCaloCells    = BIT(5),  // EMCAL and PHOS cells
+   kDataVZERO        = BIT(6),  // VZERO data
+   kDataT0           = BIT(7),  // T0 data
+   kDataZDC          = BIT(8),  // ZDC data
+   kDataTOFHeader    = BIT(9),  // TOF header
+   kDataPID          = BIT(10), // PID response
+   kDataAll          = 0xffffffff
+};
+
 protected:
   const AliTender          *fTender;         // Tender car
+  UInt_t                    fReadSet;        // Event data read by the supply (ETenderData bits)
+  UInt_t                    fWriteSet;       // Event data modified by the supply (ETenderData bits)
   
 public:  
   AliTenderSupply();
@@ -33,7 +52,17 @@ public:
   virtual void              ProcessEvent() = 0;
   
   void                      SetTender(const AliTender *tender) {fTender = tender;}
+  
+  // Scheduling: supplies with disjoint data sets do not depend on each other.
+  // By default a supply reads and writes everything and runs in the order it was added.
+  void                      SetDataSets(UInt_t readSet, UInt_t writeSet) {fReadSet = readSet; fWriteSet = writeSet;}
+  UInt_t                    GetReadSet() const {return fReadSet;}
+  UInt_t                    GetWriteSet() const {return fWriteSet;}
+  Bool_t                    DependsOn(const AliTenderSupply *other) const
+                              {return (fReadSet & other->fWriteSet) || (fWriteSet & (other->fReadSet | other->fWriteSet));}
+  // Supplies returning true may process an event concurrently with other independent supplies.
+  virtual Bool_t            IsThreadSafe() const {return kFALSE;}
     
-  ClassDef(AliTenderSupply,1)  // Base class for tender user algorithms
+  ClassDef(AliTenderSupply,2)  // Base class for tender user algorithms
 };
 #endif
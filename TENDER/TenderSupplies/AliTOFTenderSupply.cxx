@@ -44,6 +44,7 @@
 #include <AliCDBEntry.h>
 
 #include <AliOADBContainer.h>
+#include <AliCalibObjectCache.h>
 #include <AliTOFPIDParams.h>
 
 #include <AliT0CalibSeasonTimeShift.h>
@@ -1267,19 +1268,14 @@ void AliTOFTenderSupply::LoadTOFPIDParams(Int_t runNumber)
   if (fTOFPIDParams) delete fTOFPIDParams;
   fTOFPIDParams=0x0;
   
-  //  TFile *oadbf = new TFile("$ALICE_PHYSICS/OADB/COMMON/PID/data/TOFPIDParams.root");
-  TFile *oadbf = new TFile(Form("%s/COMMON/PID/data/TOFPIDParams.root",AliAnalysisManager::GetOADBPath()));
-  if (oadbf && oadbf->IsOpen()) {
-    AliInfo(Form("Tender loading TOF OADB Params from %s/COMMON/PID/data/TOFPIDParams.root",AliAnalysisManager::GetOADBPath()));
-    AliOADBContainer *oadbc = (AliOADBContainer *)oadbf->Get("TOFoadb");
-    Int_t passNr = fRecoPass;
-    if (fIsMC) passNr=2;   // this is because tender on MC is used only for pass2 LHC10
-    TString passName = Form("pass%d",passNr);
-    if (oadbc) fTOFPIDParams = dynamic_cast<AliTOFPIDParams *>(oadbc->GetObject(runNumber,"TOFparams",passName));
-    oadbf->Close();
-    delete oadbc;
-  }
-  delete oadbf;
+  // the container is read once per job through the calibration cache,
+  // the supply owns a copy of the parameters
+  AliInfo(Form("Tender loading TOF OADB Params from %s/COMMON/PID/data/TOFPIDParams.root",AliAnalysisManager::GetOADBPath()));
+  Int_t passNr = fRecoPass;
+  if (fIsMC) passNr=2;   // this is because tender on MC is used only for pass2 LHC10
+  TString passName = Form("pass%d",passNr);
+  AliTOFPIDParams *params = dynamic_cast<AliTOFPIDParams *>(AliCalibObjectCache::Instance()->GetOADBObject(Form("%s/COMMON/PID/data/TOFPIDParams.root",AliAnalysisManager::GetOADBPath()),"TOFoadb",runNumber,"TOFparams",passName.Data()));
+  if (params) fTOFPIDParams = (AliTOFPIDParams *)params->Clone();
 
   if (!fTOFPIDParams) {
     AliError(Form("TOFPIDParams.root not found in %s/COMMON/PID/data !!",AliAnalysisManager::GetOADBPath()));
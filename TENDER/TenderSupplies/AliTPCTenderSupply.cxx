@@ -44,6 +44,7 @@
 #include <AliCDBEntry.h>
 #include <AliCDBRunRange.h>
 #include <AliTender.h>
+#include <AliCalibObjectCache.h>
 #include <AliTPCcalibDButil.h>
 #include <AliPID.h>
 
@@ -281,13 +282,14 @@ void AliTPCTenderSupply::SetSplines()
   //
   fPcorrection=kFALSE;
   
-  AliCDBEntry *entryGRP=fTender->GetCDBManager()->Get("GRP/GRP/Data",fTender->GetRun());
-  if (!entryGRP) {
+  // the GRP object is shared through the calibration cache, valid for the whole validity range
+  AliGRPObject *grp=dynamic_cast<AliGRPObject*>(AliCalibObjectCache::Instance()->GetCDBObject("GRP/GRP/Data",fTender->GetRun()));
+  if (!grp) {
     AliError("No new GRP entry found");
   } else {
-    fGRP = (AliGRPObject*)entryGRP->GetObject();
+    fGRP = grp;
   }
-  if (fDebugLevel>1) AliInfo(Form("GRP entry used: %s",entryGRP->GetId().ToString().Data()));
+  if (fDebugLevel>1) AliInfo(Form("GRP entry used for run %d",fTender->GetRun()));
   
   fGainNew=0x0;
   fGainOld=0x0;
@@ -521,10 +523,9 @@ void AliTPCTenderSupply::SetParametrisation()
   }
   
   //Get CDB Entry with pid response parametrisations
-  AliCDBEntry *pidCDB=fTender->GetCDBManager()->Get("TPC/Calib/PidResponse",fTender->GetRun());
-  if (!fArrPidResponseMaster && pidCDB){
-    fArrPidResponseMaster=dynamic_cast<TObjArray*>(pidCDB->GetObject());
-    AliInfo(Form("Using pid response objects: %s",pidCDB->GetId().ToString().Data()));
+  if (!fArrPidResponseMaster){
+    fArrPidResponseMaster=dynamic_cast<TObjArray*>(AliCalibObjectCache::Instance()->GetCDBObject("TPC/Calib/PidResponse",fTender->GetRun()));
+    if (fArrPidResponseMaster) AliInfo(Form("Using pid response objects for run %d",fTender->GetRun()));
   }
 
   if (!fArrPidResponseMaster){
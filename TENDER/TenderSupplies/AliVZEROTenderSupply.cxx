@@ -53,6 +53,7 @@ AliVZEROTenderSupply::AliVZEROTenderSupply() :
   //
   // default ctor
   //
+  SetDataSets(kDataHeader|kDataVZERO, kDataVZERO);
 }
 
 //_____________________________________________________
@@ -67,6 +68,7 @@ AliVZEROTenderSupply::AliVZEROTenderSupply(const char *name, const AliTender *te
   //
   // named ctor
   //
+  SetDataSets(kDataHeader|kDataVZERO, kDataVZERO);
 }
 
 //_____________________________________________________